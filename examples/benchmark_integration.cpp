@@ -0,0 +1,82 @@
+/**
+ * @file
+ *
+ * @brief Provides the benchmark firmware used to measure the runtime performance of the library on the target
+ * microcontroller.
+ *
+ * Uses the BenchmarkModule and IdleModule classes implemented in the benchmark_module.h file. The firmware is built
+ * via the 'benchmark' PlatformIO environments, which also enable the Kernel performance telemetry. The companion PC
+ * interface drives the measurements by sending BenchmarkModule commands and kReportPerformance Kernel commands. The
+ * round-trip latency of Kernel-addressed commands is measured on the PC by timing the responses to the
+ * kIdentifyController Kernel command.
+ */
+
+#include <Arduino.h>
+#include "../examples/benchmark_module.h"
+#include "communication.h"
+#include "kernel.h"
+#include "module.h"
+
+/**
+ * @def AXMC_BENCHMARK_BAUD_RATE
+ * @brief Determines the baud rate of the serial connection used by the benchmark firmware. This is ignored by boards
+ * that use the native USB connection, such as Teensy boards.
+ */
+#ifndef AXMC_BENCHMARK_BAUD_RATE
+#define AXMC_BENCHMARK_BAUD_RATE 115200
+#endif
+
+/// Specifies the unique identifier for the benchmark microcontroller.
+static constexpr uint8_t kControllerID = 250;
+
+// Initializes the Communication class. The benchmark does not use message batching, so every message is sent as soon
+// as it is produced.
+// NOLINTNEXTLINE(cppcoreguidelines-interfaces-global-init)
+Communication axmc_communication(Serial);
+
+// Creates the module that carries out the throughput and latency measurements.
+BenchmarkModule benchmark_module(1, 1, axmc_communication);
+
+// Creates the module that runs the timer-executed interrupt tick command observed by the latency measurement. The
+// ticks have to run on a separate instance, as queueing the measurement command on the ticking instance stops its
+// timer.
+BenchmarkModule interrupt_module(1, 2, axmc_communication);
+
+// Creates the modules that only contribute the per-module overhead to the Kernel runtime cycle. Comparing the cycle
+// duration statistics reported by the performance telemetry between builds that use different numbers of idle modules
+// yields the per-module cycle overhead.
+IdleModule idle_module_1(2, 1, axmc_communication);
+IdleModule idle_module_2(2, 2, axmc_communication);
+IdleModule idle_module_3(2, 3, axmc_communication);
+IdleModule idle_module_4(2, 4, axmc_communication);
+
+// Packages all module instances into an array to be managed by the Kernel class.
+Module* modules[] = {
+    &benchmark_module,
+    &interrupt_module,
+    &idle_module_1,
+    &idle_module_2,
+    &idle_module_3,
+    &idle_module_4,
+};
+
+// Instantiates the Kernel class without the keepalive mechanism, as the throughput measurements block the Kernel
+// runtime cycle.
+Kernel axmc_kernel(kControllerID, axmc_communication, modules);
+
+// This function is only executed once. Initializes the serial communication and sets up the Kernel and all managed
+// modules.
+void setup()
+{
+    Serial.begin(AXMC_BENCHMARK_BAUD_RATE);
+#if AXMC_ENABLE_TIMER_EXECUTION
+    benchmark_module.SetInterruptSource(interrupt_module);
+#endif
+    axmc_kernel.Setup();
+}
+
+// This function is executed repeatedly while the microcontroller is powered.
+void loop()
+{
+    axmc_kernel.RuntimeCycle();
+}
@@ -0,0 +1,284 @@
+/**
+ * @file
+ *
+ * @brief Provides the hardware module classes used by the benchmark firmware to measure the runtime performance of the
+ * AXMC library on the target microcontroller.
+ *
+ * The BenchmarkModule measures the rate at which the library can send Module data and state messages to the PC for
+ * various payload sizes and, if the timer execution is enabled, the latency between a hardware timer interrupt and the
+ * main loop servicing the interrupt. The IdleModule does not execute any commands and is used to measure the per-module
+ * overhead of the Kernel runtime cycle.
+ *
+ * @note See the benchmark_integration.cpp file for the firmware that uses these modules. The firmware is built via the
+ * 'benchmark' PlatformIO environments.
+ */
+
+#ifndef AXMC_BENCHMARK_MODULE_H
+#define AXMC_BENCHMARK_MODULE_H
+
+#include <Arduino.h>
+#include "module.h"
+
+/**
+ * @brief Measures the message transmission throughput and the interrupt servicing latency of the controller in response
+ * to commands received from the PC.
+ *
+ * Each throughput measurement sends filler messages to the PC for the duration of the measurement window, which blocks
+ * the Kernel runtime cycle, and then reports the number of messages sent during the window as a data message. The PC
+ * discards the filler messages and uses the reported numbers to compute the messages and bytes sent per second.
+ */
+class BenchmarkModule final : public Module
+{
+    public:
+        /// Defines the state codes used by the class when communicating with the PC.
+        enum class kCustomStatusCodes : uint8_t
+        {
+            kFiller           = 51,  ///< The filler message sent during throughput measurements.
+            kStateThroughput  = 52,  ///< Reports the state message throughput as the size, count, and window duration.
+            kDataThroughput   = 53,  ///< Reports the data message throughput as the size, count, and window duration.
+            kInterruptLatency = 54,  ///< Reports the interrupt servicing latency count, minimum, maximum, and mean.
+        };
+
+        /// Defines the codes for the commands that can be executed by the module.
+        enum class kModuleCommands : uint8_t
+        {
+            kMeasureStateThroughput  = 1,  ///< Measures the Module state message throughput.
+            kMeasureDataThroughput   = 2,  ///< Measures the Module data message throughput for all payload sizes.
+            kInterruptTick           = 3,  ///< Records the time of each hardware timer interrupt. Timer-executed.
+            kMeasureInterruptLatency = 4,  ///< Measures the latency between the timer interrupt and the main loop.
+        };
+
+        /// Initializes the base Module class with the provided type, id, and communication instance.
+        BenchmarkModule(const uint8_t module_type, const uint8_t module_id, Communication& communication) :
+            Module(module_type, module_id, communication)
+        {}
+
+        /// Overwrites the module's runtime parameters structure with the data received from the PC.
+        bool SetCustomParameters() override
+        {
+            return ExtractParameters(_custom_parameters);
+        }
+
+        /// Resolves and executes the currently active command.
+        bool RunActiveCommand() override
+        {
+            switch (static_cast<kModuleCommands>(get_active_command()))
+            {
+                case kModuleCommands::kMeasureStateThroughput: MeasureStateThroughput(); return true;
+                case kModuleCommands::kMeasureDataThroughput: MeasureDataThroughput(); return true;
+#if AXMC_ENABLE_TIMER_EXECUTION
+                case kModuleCommands::kMeasureInterruptLatency: MeasureInterruptLatency(); return true;
+#endif
+                default: return false;
+            }
+        }
+
+        /// Sets up the instance's software assets to default values.
+        bool SetupModule() override
+        {
+            _custom_parameters.window_duration = 1000000;
+            _custom_parameters.latency_samples = 1000;
+
+#if AXMC_ENABLE_TIMER_EXECUTION
+            // The interrupt tick command only runs from the hardware timer interrupt.
+            SetTimedCommand(static_cast<uint8_t>(kModuleCommands::kInterruptTick));
+#endif
+
+            return true;
+        }
+
+#if AXMC_ENABLE_TIMER_EXECUTION
+        /**
+         * @brief Sets the instance whose timer-executed interrupt tick command is used to measure the interrupt
+         * servicing latency.
+         *
+         * The source has to be a different instance, as the running timer-executed command is stopped when another
+         * command is queued for the same instance, and the timer is not started while another command is active.
+         *
+         * @param source The instance that runs the interrupt tick command as a recurrent command.
+         */
+        void SetInterruptSource(BenchmarkModule& source)
+        {
+            _interrupt_source = &source;
+        }
+
+        /// Records the time of the hardware timer interrupt that executes the interrupt tick command.
+        void RunTimedCommand() override
+        {
+            _interrupt_time    = micros();
+            _interrupt_pending = true;
+        }
+#endif
+
+        /// Destroys the instance during cleanup.
+        ~BenchmarkModule() override = default;
+
+    private:
+        /// Stores the instance's PC-addressable runtime parameters.
+        struct CustomRuntimeParameters
+        {
+                uint32_t window_duration = 1000000;  ///< The duration, in microseconds, of each throughput window.
+                uint32_t latency_samples = 1000;     ///< The number of interrupts used to measure the latency.
+        } PACKED_STRUCT _custom_parameters;
+
+#if AXMC_ENABLE_TIMER_EXECUTION
+        /// Stores the time, in microseconds, of the most recent timer interrupt.
+        volatile uint32_t _interrupt_time = 0;
+
+        /// Determines whether the most recent timer interrupt has not yet been serviced by the main loop.
+        volatile bool _interrupt_pending = false;
+
+        /// Stores the instance that runs the interrupt tick command used to measure the interrupt servicing latency.
+        BenchmarkModule* _interrupt_source = nullptr;
+
+        /// Accumulates the interrupt servicing latency statistics: the sample count, minimum, maximum, and total.
+        uint32_t _latency_statistics[4] = {};  // NOLINT(*-avoid-c-arrays)
+#endif
+
+        /**
+         * @brief Repeatedly calls the input message sender for the duration of the throughput window and reports the
+         * number of sent messages to the PC.
+         *
+         * @tparam Sender The type of the callable that sends a single filler message.
+         * @param event_code The event code used to report the measurement results.
+         * @param message_size The size, in bytes, of each sent message payload.
+         * @param sender The callable that sends a single filler message.
+         */
+        template <typename Sender>
+        void MeasureThroughput(const kCustomStatusCodes event_code, const uint32_t message_size, Sender&& sender)
+        {
+            uint32_t message_count = 0;
+            uint32_t elapsed       = 0;
+            const uint32_t start   = micros();
+            while (elapsed < _custom_parameters.window_duration)
+            {
+                sender();
+                message_count++;
+                elapsed = micros() - start;
+            }
+
+            const uint32_t results[3] = {message_size, message_count, elapsed};  // NOLINT(*-avoid-c-arrays)
+            SendData(static_cast<uint8_t>(event_code), results);
+        }
+
+        /// Measures the Module state message throughput.
+        void MeasureStateThroughput()
+        {
+            MeasureThroughput(
+                kCustomStatusCodes::kStateThroughput,
+                sizeof(Communication::ModuleStateHeader),
+                [this]() { SendData(static_cast<uint8_t>(kCustomStatusCodes::kFiller)); }
+            );
+            CompleteCommand();
+        }
+
+        /// Measures the Module data message throughput for each supported payload size.
+        void MeasureDataThroughput()
+        {
+            MeasureDataThroughput<1, 2, 4, 8, 16, 32, 64, 128, 248>();
+            CompleteCommand();
+        }
+
+        /// Measures the Module data message throughput for each input payload size that fits into the message
+        /// payload buffer.
+        template <const size_t kPayloadSize, const size_t... kRemainingSizes>
+        void MeasureDataThroughput()
+        {
+            if constexpr (kPayloadSize <= Communication::get_maximum_module_object_size())
+            {
+                const uint8_t payload[kPayloadSize] = {};  // NOLINT(*-avoid-c-arrays)
+                MeasureThroughput(
+                    kCustomStatusCodes::kDataThroughput,
+                    sizeof(Communication::ModuleDataHeader) + kPayloadSize,
+                    [this, &payload]() { SendData(static_cast<uint8_t>(kCustomStatusCodes::kFiller), payload); }
+                );
+            }
+            if constexpr (sizeof...(kRemainingSizes) > 0) MeasureDataThroughput<kRemainingSizes...>();
+        }
+
+#if AXMC_ENABLE_TIMER_EXECUTION
+        /**
+         * @brief Measures the delay between each timer interrupt and the main loop servicing the interrupt.
+         *
+         * @note This command has to be executed while the interrupt source instance (see SetInterruptSource()) runs
+         * the interrupt tick command as a recurrent command. If the instance does not have a valid interrupt source,
+         * the command is aborted.
+         */
+        void MeasureInterruptLatency()
+        {
+            if (_interrupt_source == nullptr || _interrupt_source == this)
+            {
+                AbortCommand();
+                return;
+            }
+            BenchmarkModule& source = *_interrupt_source;
+
+            // Stage 1: Discards the interrupt recorded before the measurement started.
+            if (get_command_stage() == 1)
+            {
+                _latency_statistics[0] = 0;
+                _latency_statistics[1] = UINT32_MAX;
+                _latency_statistics[2] = 0;
+                _latency_statistics[3] = 0;
+                source._interrupt_pending = false;
+                AdvanceCommandStage();
+                return;
+            }
+
+            // Stage 2: Waits for each interrupt and accumulates the latency statistics.
+            noInterrupts();
+            const bool pending            = source._interrupt_pending;
+            const uint32_t interrupt_time = source._interrupt_time;
+            source._interrupt_pending     = false;
+            interrupts();
+            if (!pending) return;
+
+            const uint32_t latency = micros() - interrupt_time;
+            _latency_statistics[0]++;
+            if (latency < _latency_statistics[1]) _latency_statistics[1] = latency;
+            if (latency > _latency_statistics[2]) _latency_statistics[2] = latency;
+            _latency_statistics[3] += latency;
+            if (_latency_statistics[0] < _custom_parameters.latency_samples) return;
+
+            // Replaces the total latency with the mean latency before sending the statistics to the PC.
+            _latency_statistics[3] /= _latency_statistics[0];
+            SendData(static_cast<uint8_t>(kCustomStatusCodes::kInterruptLatency), _latency_statistics);
+            CompleteCommand();
+        }
+#endif
+};
+
+/**
+ * @brief Does not execute any commands. Used to measure the per-module overhead of the Kernel runtime cycle.
+ */
+class IdleModule final : public Module
+{
+    public:
+        /// Initializes the base Module class with the provided type, id, and communication instance.
+        IdleModule(const uint8_t module_type, const uint8_t module_id, Communication& communication) :
+            Module(module_type, module_id, communication)
+        {}
+
+        /// Does not accept any runtime parameters.
+        bool SetCustomParameters() override
+        {
+            return false;
+        }
+
+        /// Does not support any commands.
+        bool RunActiveCommand() override
+        {
+            return false;
+        }
+
+        /// Does not manage any hardware or software assets.
+        bool SetupModule() override
+        {
+            return true;
+        }
+
+        /// Destroys the instance during cleanup.
+        ~IdleModule() override = default;
+};
+
+#endif  //AXMC_BENCHMARK_MODULE_H
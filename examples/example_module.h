@@ -95,34 +95,19 @@ class TestModule final : public Module
         /// Emits a square digital pulse using the managed pin.
         void Pulse()
         {
-            switch (get_command_stage())
-            {
-                // Stage 1: Activates the pin.
-                case 1:
-                    digitalWrite(kPin, HIGH);
-                    SendData(static_cast<uint8_t>(kCustomStatusCodes::kHigh));
-                    AdvanceCommandStage();
-                    return;
-
-                // Stage 2: Waits for the specified on_duration.
-                case 2:
-                    if (WaitForMicros(_custom_parameters.on_duration)) AdvanceCommandStage();
-                    return;
-
-                // Stage 3: Disables the pin.
-                case 3:
-                    digitalWrite(kPin, LOW);
-                    SendData(static_cast<uint8_t>(kCustomStatusCodes::kLow));
-                    AdvanceCommandStage();
-                    return;
-
-                // Stage 4: Ensures the pin is kept off for at least the specified off_duration.
-                case 4:
-                    if (WaitForMicros(_custom_parameters.off_duration)) CompleteCommand();
-                    return;
-
-                default: AbortCommand(); return;
-            }
+            AXMC_COMMAND_BEGIN();
+
+            // Activates the pin and waits for the specified on_duration.
+            digitalWrite(kPin, HIGH);
+            SendData(static_cast<uint8_t>(kCustomStatusCodes::kHigh));
+            AXMC_AWAIT_MICROS(_custom_parameters.on_duration);
+
+            // Disables the pin and ensures it is kept off for at least the specified off_duration.
+            digitalWrite(kPin, LOW);
+            SendData(static_cast<uint8_t>(kCustomStatusCodes::kLow));
+            AXMC_AWAIT_MICROS(_custom_parameters.off_duration);
+
+            AXMC_COMMAND_END();
         }
 
         /// Sends the current value of the 'echo_value' parameter to the PC.
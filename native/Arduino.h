@@ -0,0 +1,202 @@
+/**
+ * @file
+ *
+ * @brief Provides the minimal subset of the Arduino core API used by the library and its dependencies, allowing them
+ * to be compiled and profiled on the host computer via the 'native' PlatformIO environment.
+ *
+ * The timing functions use the host's monotonic clock, and all hardware pin functions are no-ops. The Serial instance
+ * discards all written data and never has data to read.
+ *
+ * @warning This file is only used by the 'native' PlatformIO environment and is not part of the compiled library.
+ */
+
+#ifndef AXMC_NATIVE_ARDUINO_H
+#define AXMC_NATIVE_ARDUINO_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+/// Emulates the USB serial buffer size of Teensy boards, which use the largest buffers among the supported boards.
+#ifndef SERIAL_RX_BUFFER_SIZE
+#define SERIAL_RX_BUFFER_SIZE 8192
+#endif
+#ifndef SERIAL_TX_BUFFER_SIZE
+#define SERIAL_TX_BUFFER_SIZE 8192
+#endif
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+#define LED_BUILTIN 13
+
+template <typename A, typename B>
+constexpr auto min(const A& a, const B& b) -> decltype(a < b ? a : b)
+{
+    return b < a ? b : a;
+}
+
+template <typename A, typename B>
+constexpr auto max(const A& a, const B& b) -> decltype(a < b ? a : b)
+{
+    return a < b ? b : a;
+}
+
+namespace axmc_native
+{
+    /// Returns the time point at which the host process started, used as the zero point of the Arduino clock.
+    inline std::chrono::steady_clock::time_point GetStartTime()
+    {
+        static const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+        return start_time;
+    }
+}  // namespace axmc_native
+
+/// Returns the number of microseconds elapsed since the host process started. Overflows after ~71 minutes, as on the
+/// supported microcontrollers.
+inline uint32_t micros()
+{
+    const auto elapsed = std::chrono::steady_clock::now() - axmc_native::GetStartTime();
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+}
+
+/// Returns the number of milliseconds elapsed since the host process started.
+inline uint32_t millis()
+{
+    const auto elapsed = std::chrono::steady_clock::now() - axmc_native::GetStartTime();
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+}
+
+inline void delay(const uint32_t milliseconds)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+}
+
+inline void delayMicroseconds(const uint32_t microseconds)
+{
+    std::this_thread::sleep_for(std::chrono::microseconds(microseconds));
+}
+
+inline void pinMode(uint8_t, uint8_t)
+{}
+
+inline void digitalWrite(uint8_t, uint8_t)
+{}
+
+inline int digitalRead(uint8_t)
+{
+    return LOW;
+}
+
+inline int analogRead(uint8_t)
+{
+    return 0;
+}
+
+inline void analogReadResolution(int)
+{}
+
+inline void noInterrupts()
+{}
+
+inline void interrupts()
+{}
+
+/// Mirrors the Arduino Print class interface used to write data to the serial ports.
+class Print
+{
+    public:
+        virtual ~Print() = default;
+
+        virtual size_t write(uint8_t value) = 0;
+
+        virtual size_t write(const uint8_t* buffer, const size_t size)
+        {
+            size_t written = 0;
+            while (written < size && write(buffer[written]) == 1) written++;
+            return written;
+        }
+
+        virtual int availableForWrite()
+        {
+            return 0;
+        }
+
+        virtual void flush()
+        {}
+};
+
+/// Mirrors the Arduino Stream class interface used to exchange data with the PC.
+class Stream : public Print
+{
+    public:
+        using Print::write;
+
+        virtual int available() = 0;
+        virtual int read()      = 0;
+        virtual int peek()      = 0;
+
+        size_t readBytes(uint8_t* buffer, const size_t length)
+        {
+            size_t count = 0;
+            while (count < length)
+            {
+                const int value = read();
+                if (value < 0) break;
+                buffer[count++] = static_cast<uint8_t>(value);
+            }
+            return count;
+        }
+
+        void setTimeout(uint32_t)
+        {}
+};
+
+/// Discards all written data and never has data to read.
+class HardwareSerial final : public Stream
+{
+    public:
+        void begin(uint32_t)
+        {}
+
+        void end()
+        {}
+
+        size_t write(uint8_t) override
+        {
+            return 1;
+        }
+
+        size_t write(const uint8_t*, const size_t size) override
+        {
+            return size;
+        }
+
+        int availableForWrite() override
+        {
+            return SERIAL_TX_BUFFER_SIZE;
+        }
+
+        int available() override
+        {
+            return 0;
+        }
+
+        int read() override
+        {
+            return -1;
+        }
+
+        int peek() override
+        {
+            return -1;
+        }
+};
+
+inline HardwareSerial Serial;
+
+#endif  //AXMC_NATIVE_ARDUINO_H
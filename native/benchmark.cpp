@@ -0,0 +1,249 @@
+/**
+ * @file
+ *
+ * @brief Provides the microbenchmark harness that profiles the Communication and Kernel classes on the host computer.
+ *
+ * The harness pushes synthetic PC-sent message frames through the Communication class via the LoopbackStream, measures
+ * the cost of packaging and sending Module data messages, and measures the duration of the Kernel runtime cycle for
+ * various numbers of managed modules and incoming message rates. All results are printed to the standard output as
+ * comma-separated values, one measurement per line.
+ *
+ * @note Build and run the harness via the 'pio run -e native -t exec' command. The optional command-line argument
+ * scales the number of iterations used by each measurement (default 1). The produced executable can be profiled with
+ * the standard host tools, such as perf or callgrind.
+ */
+
+#include <Arduino.h>
+#include <cobs_processor.h>
+#include <crc_processor.h>
+#include <cstdio>
+#include <cstdlib>
+#include <initializer_list>
+#include "communication.h"
+#include "kernel.h"
+#include "loopback_stream.h"
+#include "module.h"
+
+/// The type of the CRC checksum used by the Communication class.
+#if AXMC_CRC_WIDTH == 8
+using CrcType = uint8_t;
+#elif AXMC_CRC_WIDTH == 16
+using CrcType = uint16_t;
+#else
+using CrcType = uint32_t;
+#endif
+
+/// The size, in bytes, of each direction's LoopbackStream buffer.
+static constexpr size_t kStreamCapacity = 1 << 20;
+
+/// The connection shared by the benchmarked Communication instances. Statically allocated due to its size.
+static LoopbackStream<kStreamCapacity> loopback_stream;  // NOLINT(*-avoid-non-const-global-variables)
+
+/**
+ * @brief Encodes the input message payload into a frame that can be received by the Communication class.
+ *
+ * @tparam kPayloadSize The size of the message payload, in bytes.
+ */
+template <const size_t kPayloadSize>
+struct EncodedFrame
+{
+        /// Stores the start byte, payload size, COBS overhead, payload, delimiter, and checksum.
+        uint8_t data[kPayloadSize + 4 + sizeof(CrcType)] = {};  // NOLINT(*-avoid-c-arrays)
+
+        explicit EncodedFrame(const uint8_t (&payload)[kPayloadSize])  // NOLINT(*-avoid-c-arrays)
+        {
+            data[0] = 129;
+            data[1] = kPayloadSize;
+            memcpy(data + 3, payload, kPayloadSize);
+
+            COBSProcessor cobs_processor;
+            CRCProcessor<CrcType> crc_processor(
+                static_cast<CrcType>(AXMC_CRC_POLYNOMIAL),
+                static_cast<CrcType>(AXMC_CRC_INITIAL_VALUE),
+                static_cast<CrcType>(AXMC_CRC_FINAL_XOR_VALUE)
+            );
+            cobs_processor.EncodePayload(data);
+            crc_processor.CalculateChecksum<false>(data);
+        }
+};
+
+/// Returns the encoded one-off command frame addressed to the specified module.
+static EncodedFrame<6> MakeCommandFrame(const uint8_t module_type, const uint8_t module_id)
+{
+    const uint8_t payload[6] = {
+        static_cast<uint8_t>(axmc_communication_assets::kProtocols::kOneOffModuleCommand),
+        module_type,
+        module_id,
+        0,  // Return code
+        1,  // Command
+        0,  // Noblock
+    };
+    return EncodedFrame<6>(payload);
+}
+
+/// Returns the number of nanoseconds elapsed since the input time point.
+static double ElapsedNanoseconds(const std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Executes a single-stage command for each received command message. Used to populate the Kernel with
+ * hundreds of modules.
+ */
+class ProfilingModule final : public Module
+{
+    public:
+        using Module::Module;
+
+        bool SetCustomParameters() override
+        {
+            return ExtractParameters(_parameter);
+        }
+
+        bool RunActiveCommand() override
+        {
+            _parameter++;
+            CompleteCommand();
+            return true;
+        }
+
+        bool SetupModule() override
+        {
+            _parameter = 0;
+            return true;
+        }
+
+    private:
+        /// Stores the runtime parameter updated by each executed command.
+        uint32_t _parameter = 0;
+};
+
+/// Measures the cost of receiving and parsing the PC-sent module command messages.
+static void BenchmarkReception(Communication& communication, const size_t frame_count)
+{
+    const auto frame           = MakeCommandFrame(1, 1);
+    const size_t chunk_size    = kStreamCapacity / sizeof(frame.data);
+    size_t received            = 0;
+    double elapsed_nanoseconds = 0;
+
+    while (received < frame_count)
+    {
+        const size_t chunk = min(chunk_size, frame_count - received);
+        for (size_t i = 0; i < chunk; i++) loopback_stream.WriteToController(frame.data, sizeof(frame.data));
+
+        const auto start = std::chrono::steady_clock::now();
+        while (communication.ReceiveMessage()) received++;
+        elapsed_nanoseconds += ElapsedNanoseconds(start);
+
+        // Prevents infinite loops if the reception fails for any reason.
+        if (loopback_stream.available() > 0) break;
+    }
+
+    printf("reception,frames=%zu,ns_per_frame=%.1f\n", received, elapsed_nanoseconds / static_cast<double>(received));
+}
+
+/// Measures the cost of packaging and sending the Module data messages.
+static void BenchmarkTransmission(Communication& communication, const size_t message_count)
+{
+    const uint64_t bytes_before = loopback_stream.get_bytes_written();
+    const auto start            = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < message_count; i++)
+    {
+        communication.SendDataMessage(1, 1, 1, 52, static_cast<uint32_t>(i));
+    }
+    const double elapsed_nanoseconds = ElapsedNanoseconds(start);
+    const uint64_t bytes             = loopback_stream.get_bytes_written() - bytes_before;
+
+    printf(
+        "transmission,messages=%zu,bytes=%llu,ns_per_message=%.1f\n",
+        message_count,
+        static_cast<unsigned long long>(bytes),
+        elapsed_nanoseconds / static_cast<double>(message_count)
+    );
+}
+
+/**
+ * @brief Measures the duration of the Kernel runtime cycle for the specified number of managed modules and incoming
+ * command messages per cycle.
+ *
+ * @tparam kModuleCount The number of modules managed by the Kernel.
+ * @param communication The Communication instance used by the Kernel.
+ * @param cycle_count The number of measured runtime cycles.
+ * @param messages_per_cycle The number of module command messages received during each cycle.
+ */
+template <const size_t kModuleCount>
+static void BenchmarkKernel(Communication& communication, const size_t cycle_count, const size_t messages_per_cycle)
+{
+    static Module* modules[kModuleCount];  // NOLINT(*-avoid-c-arrays)
+    static EncodedFrame<6>* frames[kModuleCount];  // NOLINT(*-avoid-c-arrays)
+    for (size_t i = 0; i < kModuleCount; i++)
+    {
+        // Skips the module ID reserved for the broadcast commands, as the Kernel rejects it during setup.
+        const auto module_type = static_cast<uint8_t>(1 + i / 254);
+        const auto module_id   = static_cast<uint8_t>(1 + i % 254);
+        modules[i]             = new ProfilingModule(module_type, module_id, communication);
+        frames[i]              = new EncodedFrame<6>(MakeCommandFrame(module_type, module_id));
+    }
+
+    Kernel kernel(1, communication, modules);
+    kernel.Setup();
+
+    size_t next_target         = 0;
+    double elapsed_nanoseconds = 0;
+    for (size_t cycle = 0; cycle < cycle_count; cycle++)
+    {
+        for (size_t i = 0; i < messages_per_cycle; i++)
+        {
+            loopback_stream.WriteToController(frames[next_target]->data, sizeof(frames[next_target]->data));
+            next_target = (next_target + 1) % kModuleCount;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        kernel.RuntimeCycle();
+        elapsed_nanoseconds += ElapsedNanoseconds(start);
+    }
+
+    printf(
+        "kernel,modules=%zu,messages_per_cycle=%zu,cycles=%zu,ns_per_cycle=%.1f\n",
+        kModuleCount,
+        messages_per_cycle,
+        cycle_count,
+        elapsed_nanoseconds / static_cast<double>(cycle_count)
+    );
+
+    for (size_t i = 0; i < kModuleCount; i++)
+    {
+        delete modules[i];
+        delete frames[i];
+    }
+}
+
+/// Measures the Kernel runtime cycle duration for the input number of modules across multiple message rates.
+template <const size_t kModuleCount>
+static void BenchmarkKernelScaling(Communication& communication, const size_t cycle_count)
+{
+    for (const size_t messages_per_cycle : {0, 1, 8, 64})
+    {
+        BenchmarkKernel<kModuleCount>(communication, cycle_count, messages_per_cycle);
+    }
+}
+
+int main(const int argc, char** argv)
+{
+    const size_t scale = argc > 1 ? strtoul(argv[1], nullptr, 10) : 1;
+
+    // The benchmarks only measure the controller side, so the messages sent to the PC are counted and discarded.
+    loopback_stream.set_discard_output(true);
+    Communication communication(loopback_stream);
+
+    BenchmarkReception(communication, 1000000 * scale);
+    BenchmarkTransmission(communication, 1000000 * scale);
+
+    BenchmarkKernelScaling<1>(communication, 100000 * scale);
+    BenchmarkKernelScaling<16>(communication, 100000 * scale);
+    BenchmarkKernelScaling<128>(communication, 10000 * scale);
+    BenchmarkKernelScaling<512>(communication, 1000 * scale);
+
+    return 0;
+}
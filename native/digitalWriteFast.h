@@ -0,0 +1,18 @@
+/**
+ * @file
+ *
+ * @brief Maps the digitalWriteFast library API to the no-op pin functions of the native Arduino core stub.
+ *
+ * @warning This file is only used by the 'native' PlatformIO environment and is not part of the compiled library.
+ */
+
+#ifndef AXMC_NATIVE_DIGITAL_WRITE_FAST_H
+#define AXMC_NATIVE_DIGITAL_WRITE_FAST_H
+
+#include <Arduino.h>
+
+#define pinModeFast(pin, mode) pinMode(pin, mode)
+#define digitalWriteFast(pin, value) digitalWrite(pin, value)
+#define digitalReadFast(pin) digitalRead(pin)
+
+#endif  //AXMC_NATIVE_DIGITAL_WRITE_FAST_H
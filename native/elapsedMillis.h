@@ -0,0 +1,64 @@
+/**
+ * @file
+ *
+ * @brief Provides the elapsedMillis and elapsedMicros timer classes backed by the clock of the native Arduino core stub.
+ *
+ * @warning This file is only used by the 'native' PlatformIO environment and is not part of the compiled library.
+ */
+
+#ifndef AXMC_NATIVE_ELAPSED_MILLIS_H
+#define AXMC_NATIVE_ELAPSED_MILLIS_H
+
+#include <Arduino.h>
+
+/// Measures the time, in milliseconds, elapsed since the instance was created or last assigned.
+class elapsedMillis
+{
+    public:
+        elapsedMillis() : _start(millis())
+        {}
+
+        explicit elapsedMillis(const uint32_t value) : _start(millis() - value)
+        {}
+
+        operator uint32_t() const  // NOLINT(*-explicit-constructor)
+        {
+            return millis() - _start;
+        }
+
+        elapsedMillis& operator=(const uint32_t value)
+        {
+            _start = millis() - value;
+            return *this;
+        }
+
+    private:
+        uint32_t _start;
+};
+
+/// Measures the time, in microseconds, elapsed since the instance was created or last assigned.
+class elapsedMicros
+{
+    public:
+        elapsedMicros() : _start(micros())
+        {}
+
+        explicit elapsedMicros(const uint32_t value) : _start(micros() - value)
+        {}
+
+        operator uint32_t() const  // NOLINT(*-explicit-constructor)
+        {
+            return micros() - _start;
+        }
+
+        elapsedMicros& operator=(const uint32_t value)
+        {
+            _start = micros() - value;
+            return *this;
+        }
+
+    private:
+        uint32_t _start;
+};
+
+#endif  //AXMC_NATIVE_ELAPSED_MILLIS_H
@@ -0,0 +1,156 @@
+/**
+ * @file
+ *
+ * @brief Provides the LoopbackStream class that connects the Communication class to a simulated PC when the library is
+ * compiled for the host computer via the 'native' PlatformIO environment.
+ *
+ * @warning This file is only used by the 'native' PlatformIO environment and is not part of the compiled library.
+ */
+
+#ifndef AXMC_NATIVE_LOOPBACK_STREAM_H
+#define AXMC_NATIVE_LOOPBACK_STREAM_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Emulates the serial connection between the microcontroller and the PC.
+ *
+ * The microcontroller side reads the data written via the PC-side WriteToController() method and writes the data that
+ * the PC side reads via the ReadFromController() method. Both directions use fixed-size ring buffers, and the
+ * controller side can write as many bytes as the outgoing buffer can store.
+ *
+ * @tparam kCapacity The size, in bytes, of each direction's ring buffer.
+ */
+template <const size_t kCapacity>
+class LoopbackStream final : public Stream
+{
+    public:
+        using Stream::write;
+
+        /// Returns the number of bytes available for the controller to read.
+        int available() override
+        {
+            return static_cast<int>(_inbound.size);
+        }
+
+        /// Reads the next byte sent by the PC or returns -1 if no data is available.
+        int read() override
+        {
+            return _inbound.Pop();
+        }
+
+        /// Returns the next byte sent by the PC without consuming it or returns -1 if no data is available.
+        int peek() override
+        {
+            return _inbound.size > 0 ? _inbound.data[_inbound.head] : -1;
+        }
+
+        /// Writes the input byte to the PC if the outgoing buffer has space.
+        size_t write(const uint8_t value) override
+        {
+            if (!_discard_output && !_outbound.Push(value)) return 0;
+            _bytes_written++;
+            return 1;
+        }
+
+        /// Writes as many bytes from the input buffer to the PC as the outgoing buffer can store.
+        size_t write(const uint8_t* buffer, const size_t size) override
+        {
+            size_t written = _discard_output ? size : 0;
+            while (written < size && _outbound.Push(buffer[written])) written++;
+            _bytes_written += written;
+            return written;
+        }
+
+        /// Returns the number of bytes the controller can write without overflowing the outgoing buffer.
+        int availableForWrite() override
+        {
+            return static_cast<int>(_discard_output ? kCapacity : kCapacity - _outbound.size);
+        }
+
+        /**
+         * @brief Sends the input data from the PC to the controller.
+         *
+         * @returns true if the whole input buffer was added to the incoming buffer, false if the buffer does not have
+         * enough space to store the data.
+         */
+        bool WriteToController(const uint8_t* buffer, const size_t size)
+        {
+            if (kCapacity - _inbound.size < size) return false;
+            for (size_t i = 0; i < size; i++) _inbound.Push(buffer[i]);
+            return true;
+        }
+
+        /// Reads the next byte sent by the controller or returns -1 if no data is available.
+        int ReadFromController()
+        {
+            return _outbound.Pop();
+        }
+
+        /**
+         * @brief Determines whether the data written by the controller is discarded instead of being buffered.
+         *
+         * @note Discarding the output allows profiling the transmission path without draining the outgoing buffer.
+         * The discarded bytes are still counted by the get_bytes_written() method.
+         */
+        void set_discard_output(const bool discard_output)
+        {
+            _discard_output = discard_output;
+        }
+
+        /// Returns the total number of bytes written by the controller, including the discarded bytes.
+        [[nodiscard]]
+        uint64_t get_bytes_written() const
+        {
+            return _bytes_written;
+        }
+
+        /// Returns the total number of bytes read by the controller.
+        [[nodiscard]]
+        uint64_t get_bytes_read() const
+        {
+            return _inbound.popped;
+        }
+
+    private:
+        /// Stores the data sent in one direction.
+        struct RingBuffer
+        {
+                uint8_t data[kCapacity] = {};  // NOLINT(*-avoid-c-arrays)
+                size_t head             = 0;
+                size_t size             = 0;
+                uint64_t popped         = 0;
+
+                bool Push(const uint8_t value)
+                {
+                    if (size == kCapacity) return false;
+                    data[(head + size) % kCapacity] = value;
+                    size++;
+                    return true;
+                }
+
+                int Pop()
+                {
+                    if (size == 0) return -1;
+                    const uint8_t value = data[head];
+                    head                = (head + 1) % kCapacity;
+                    size--;
+                    popped++;
+                    return value;
+                }
+        };
+
+        /// Stores the data sent by the PC to the controller.
+        RingBuffer _inbound;
+
+        /// Stores the data sent by the controller to the PC.
+        RingBuffer _outbound;
+
+        /// Determines whether the data written by the controller is discarded.
+        bool _discard_output = false;
+
+        /// Tracks the total number of bytes written by the controller.
+        uint64_t _bytes_written = 0;
+};
+
+#endif  //AXMC_NATIVE_LOOPBACK_STREAM_H
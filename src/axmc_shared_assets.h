@@ -35,6 +35,8 @@ namespace axmc_shared_assets
         kParameterMismatch   = 59,  ///< The size of the received parameters structure does not match expectation.
         kParametersExtracted = 60,  ///< Parameter data has been successfully extracted.
         kExtractionForbidden = 61,  ///< Attempted to extract parameters from the message other than ModuleParameters.
+        kMessageBatched      = 62,  ///< Communication class appended the message to the open batched message payload.
+        kBufferOverflow      = 63,  ///< The message frame does not fit into the transmission ring buffer.
     };
 }  // namespace axmc_shared_assets
 
@@ -68,6 +70,16 @@ namespace axmc_communication_assets
         kReceptionCode            = 10,  ///< Acknowledges the reception of command and parameter messages.
         kControllerIdentification = 11,  ///< Identifies the host-microcontroller to the PC.
         kModuleIdentification     = 12,  ///< Identifies the module instances managed by the Kernel to the PC.
+        kBatchedMessages          = 13,  ///< Bundles multiple Module and Kernel data and state messages together.
+        kTimestampedModuleData    = 14,  ///< Module data messages that include the controller time of the event.
+        kTimestampedKernelData    = 15,  ///< Kernel data messages that include the controller time of the event.
+        kTimestampedModuleState   = 16,  ///< Module state messages that include the controller time of the event.
+        kTimestampedKernelState   = 17,  ///< Kernel state messages that include the controller time of the event.
+        kReceptionCodes           = 18,  ///< Acknowledges the reception of multiple command and parameter messages.
+        kScheduledModuleCommand   = 19,  ///< Module-addressed one-off commands that start at the specified time.
+        kSequenceProgram          = 20,  ///< Kernel-addressed command sequence programs executed without the PC.
+        kPartialModuleParameters  = 21,  ///< Module-addressed parameter messages that only update a range of bytes.
+        kModuleEventLimit         = 22,  ///< Module-addressed rate limit and decimation settings for a data event.
     };
 
     /**
@@ -819,6 +831,14 @@ namespace axmc_communication_assets
                                                         [PrototypeTypeIndex<remove_extent_t<ObjectType>>()]);
     }
 
+    /**
+     * @brief The module ID that addresses the RepeatedModuleCommand, OneOffModuleCommand, ScheduledModuleCommand, and
+     * DequeueModuleCommand messages to all module instances of the specified type.
+     *
+     * @warning This ID is reserved and cannot be used by the module instances managed by the Kernel.
+     */
+    constexpr uint8_t kBroadcastModuleId = 255;
+
     /**
      * @struct RepeatedModuleCommand
      * @brief Instructs the addressed Module instance to run the specified command repeatedly (recurrently).
@@ -846,6 +866,21 @@ namespace axmc_communication_assets
             bool noblock        = false;  ///< Determines whether to allow concurrent execution of other commands.
     } PACKED_STRUCT;
 
+    /**
+     * @struct ScheduledModuleCommand
+     * @brief Instructs the addressed Module instance to run the specified command exactly once (non-recurrently),
+     * starting at the specified controller time.
+     */
+    struct ScheduledModuleCommand
+    {
+            uint8_t module_type      = 0;      ///< The type (family) code of the module addressed by the command.
+            uint8_t module_id        = 0;      ///< The ID of the specific module instance within the module family.
+            uint8_t return_code      = 0;      ///< The acknowledgment code for the message, if set to a non-zero value.
+            uint8_t command          = 0;      ///< The code of the command to execute.
+            bool noblock             = false;  ///< Determines whether to allow concurrent execution of other commands.
+            uint64_t activation_time = 0;      ///< The controller time, in microseconds, at which to run the command.
+    } PACKED_STRUCT;
+
     /**
      * @struct DequeueModuleCommand
      * @brief Instructs the addressed Module instance to clear (empty) its command queue.
@@ -867,6 +902,37 @@ namespace axmc_communication_assets
             uint8_t command     = 0;  ///< The code of the command to execute.
     } PACKED_STRUCT;
 
+    /**
+     * @struct SequenceProgram
+     * @brief Instructs the Kernel to replace its command sequence program with the included sequence steps.
+     *
+     * @note The message header is followed by one or more SequenceStep structures that make up the program.
+     */
+    struct SequenceProgram
+    {
+            uint8_t return_code   = 0;  ///< The acknowledgment code for the message, if set to a non-zero value.
+            uint16_t repeat_count = 0;  ///< The number of times to run the program. Set to 0 to repeat until stopped.
+    } PACKED_STRUCT;
+
+    /**
+     * @struct SequenceStep
+     * @brief Stores a single step of the command sequence program executed by the Kernel.
+     *
+     * Each step runs the specified number of iterations before the program advances to the next step. During each
+     * iteration, the Kernel queues the step's one-off command on the target module, optionally waits for the target
+     * module to report the awaited event, and then waits for the step's delay to expire.
+     */
+    struct SequenceStep
+    {
+            uint8_t module_type     = 0;      ///< The type (family) code of the module addressed by the step.
+            uint8_t module_id       = 0;      ///< The ID of the specific module instance within the module family.
+            uint8_t command         = 0;      ///< The code of the command to queue. Set to 0 to only wait.
+            bool noblock            = false;  ///< Determines whether to allow concurrent execution of other commands.
+            uint8_t awaited_event   = 0;      ///< The event code to wait for after queueing the command, if not 0.
+            uint8_t iteration_count = 1;      ///< The number of times to run the step.
+            uint32_t delay          = 0;      ///< The delay, in microseconds, that ends each step iteration.
+    } PACKED_STRUCT;
+
     /**
      * @struct ModuleParameters
      * @brief Instructs the addressed Module instance to update its parameters with the included data.
@@ -878,6 +944,42 @@ namespace axmc_communication_assets
             uint8_t return_code = 0;  ///< The acknowledgment code for the message, if set to a non-zero value.
     } PACKED_STRUCT;
 
+    /**
+     * @struct PartialModuleParameters
+     * @brief Instructs the addressed Module instance to update a contiguous range of bytes of its parameters with the
+     * included data.
+     *
+     * @note The first three fields of this structure match the ModuleParameters structure, which allows addressing
+     * both message types through the same header fields.
+     */
+    struct PartialModuleParameters
+    {
+            uint8_t module_type = 0;  ///< The type (family) code of the module to which parameters are addressed.
+            uint8_t module_id   = 0;  ///< The ID of the specific module instance within the broader module family.
+            uint8_t return_code = 0;  ///< The acknowledgment code for the message, if set to a non-zero value.
+            uint8_t offset      = 0;  ///< The offset, in bytes, of the first updated byte of the parameters object.
+            uint8_t length      = 0;  ///< The number of consecutive parameter bytes updated by the message.
+    } PACKED_STRUCT;
+
+    /**
+     * @struct ModuleEventLimit
+     * @brief Instructs the addressed Module instance to limit the rate at which it sends the data messages that
+     * communicate the specified event.
+     *
+     * @note Setting the decimation to 0 or 1 and the burst to 0 removes the limit configured for the event.
+     */
+    struct ModuleEventLimit
+    {
+            uint8_t module_type     = 0;      ///< The type (family) code of the module to which the limit is addressed.
+            uint8_t module_id       = 0;      ///< The ID of the specific module instance within the module family.
+            uint8_t return_code     = 0;      ///< The acknowledgment code for the message, if set to a non-zero value.
+            uint8_t event           = 0;      ///< The code of the limited event. Must be between 51 and 250.
+            uint8_t decimation      = 0;      ///< Only sends every Nth event. Values 0 and 1 send every event.
+            uint8_t burst           = 0;      ///< The token bucket capacity. A value of 0 disables the rate limit.
+            uint32_t token_interval = 0;      ///< The time, in microseconds, it takes to refill a single token.
+            bool average            = false;  ///< Determines whether to send the mean of the suppressed samples.
+    } PACKED_STRUCT;
+
     /**
      * @struct ModuleData
      * @brief Communicates that the Module has encountered a notable event and includes an additional data object.
@@ -938,6 +1040,70 @@ namespace axmc_communication_assets
             uint8_t event    = 0;  ///< The event that prompted the data transmission.
     } PACKED_STRUCT;
 
+    /**
+     * @struct TimestampedModuleData
+     * @brief Communicates that the Module has encountered a notable event at the specified controller time and
+     * includes an additional data object.
+     *
+     * @note This structure replaces the ModuleData structure when message timestamps are enabled.
+     */
+    struct TimestampedModuleData
+    {
+            uint8_t protocol    = 0;  ///< The message protocol used by this structure.
+            uint64_t timestamp  = 0;  ///< The controller time, in microseconds, at which the message was packaged.
+            uint8_t module_type = 0;  ///< The type (family) code of the module that sent the data message.
+            uint8_t module_id   = 0;  ///< The ID of the specific module instance within the broader module family.
+            uint8_t command     = 0;  ///< The command the Module was executing when it sent the data message.
+            uint8_t event       = 0;  ///< The event that prompted the data transmission.
+            uint8_t prototype   = 0;  ///< The prototype code for the data object transmitted with the message.
+    } PACKED_STRUCT;
+
+    /**
+     * @struct TimestampedKernelData
+     * @brief Communicates that the Kernel has encountered a notable event at the specified controller time and
+     * includes an additional data object.
+     *
+     * @note This structure replaces the KernelData structure when message timestamps are enabled.
+     */
+    struct TimestampedKernelData
+    {
+            uint8_t protocol   = 0;  ///< The message protocol used by this structure.
+            uint64_t timestamp = 0;  ///< The controller time, in microseconds, at which the message was packaged.
+            uint8_t command    = 0;  ///< The command the Kernel was executing when it sent the data message.
+            uint8_t event      = 0;  ///< The event that prompted the data transmission.
+            uint8_t prototype  = 0;  ///< The prototype code for the data object transmitted with the message.
+    } PACKED_STRUCT;
+
+    /**
+     * @struct TimestampedModuleState
+     * @brief Communicates that the Module has encountered a notable event at the specified controller time.
+     *
+     * @note This structure replaces the ModuleState structure when message timestamps are enabled.
+     */
+    struct TimestampedModuleState
+    {
+            uint8_t protocol    = 0;  ///< The message protocol used by this structure.
+            uint64_t timestamp  = 0;  ///< The controller time, in microseconds, at which the message was packaged.
+            uint8_t module_type = 0;  ///< The type (family) code of the module that sent the data message.
+            uint8_t module_id   = 0;  ///< The ID of the specific module instance within the broader module family.
+            uint8_t command     = 0;  ///< The command the Module was executing when it sent the data message.
+            uint8_t event       = 0;  ///< The event that prompted the data transmission.
+    } PACKED_STRUCT;
+
+    /**
+     * @struct TimestampedKernelState
+     * @brief Communicates that the Kernel has encountered a notable event at the specified controller time.
+     *
+     * @note This structure replaces the KernelState structure when message timestamps are enabled.
+     */
+    struct TimestampedKernelState
+    {
+            uint8_t protocol   = 0;  ///< The message protocol used by this structure.
+            uint64_t timestamp = 0;  ///< The controller time, in microseconds, at which the message was packaged.
+            uint8_t command    = 0;  ///< The command the Kernel was executing when it sent the data message.
+            uint8_t event      = 0;  ///< The event that prompted the data transmission.
+    } PACKED_STRUCT;
+
 }  // namespace axmc_communication_assets
 
 #endif  //AXMC_SHARED_ASSETS_H
@@ -17,6 +17,7 @@
 #include <Arduino.h>
 #include <axtlmc_shared_assets.h>
 #include <digitalWriteFast.h>
+#include <elapsedMillis.h>
 #include <transport_layer.h>
 #include "axmc_shared_assets.h"
 
@@ -24,6 +25,292 @@ using namespace axmc_shared_assets;
 using namespace axtlmc_shared_assets;
 using namespace axmc_communication_assets;
 
+/**
+ * @def AXMC_TRANSMISSION_BUFFER_SIZE
+ * @brief Determines the size, in bytes, of the ring buffer used by the Communication class to transmit messages
+ * asynchronously.
+ *
+ * When set to a non-zero value (for example, via the '-D AXMC_TRANSMISSION_BUFFER_SIZE=1024' build flag), the
+ * Communication class stores encoded message frames in the ring buffer instead of writing them to the communication
+ * port, and the Kernel writes the buffered frames to the port once per runtime cycle without blocking. By default, the
+ * asynchronous transmission mode is disabled and message frames are written directly to the communication port.
+ */
+#ifndef AXMC_TRANSMISSION_BUFFER_SIZE
+#define AXMC_TRANSMISSION_BUFFER_SIZE 0
+#endif
+
+/**
+ * @def AXMC_CRITICAL_MESSAGE_HEADROOM
+ * @brief Determines the number of bytes of the transmission path reserved for the critical messages.
+ *
+ * The droppable Module data messages, sent via the SendDroppableData() Module method, are only sent if the
+ * transmission ring buffer (or, if the asynchronous transmission mode is disabled, the communication port) can accept
+ * the message frame while keeping at least this many bytes available for the critical messages, such as the command
+ * completion and error messages. By default, the droppable messages are sent whenever they can be sent without
+ * blocking or overflowing the transmission ring buffer.
+ */
+#ifndef AXMC_CRITICAL_MESSAGE_HEADROOM
+#define AXMC_CRITICAL_MESSAGE_HEADROOM 0
+#endif
+
+/**
+ * @def AXMC_ENABLE_MESSAGE_TIMESTAMPS
+ * @brief Determines whether the Module and Kernel data and state messages include the controller time at which they
+ * were packaged.
+ *
+ * When set to a non-zero value (for example, via the '-D AXMC_ENABLE_MESSAGE_TIMESTAMPS=1' build flag), the
+ * Communication class sends all Module and Kernel data and state messages using the timestamped message protocols.
+ * Each timestamped message stores the 64-bit controller time, in microseconds, at which the message was packaged, and
+ * the Kernel supports the kSynchronizeClock command used by the PC to map the controller time to the PC time. The
+ * Kernel also accepts the ScheduledModuleCommand messages that start module commands at the specified controller time.
+ * By default, the messages do not include timestamps.
+ */
+#ifndef AXMC_ENABLE_MESSAGE_TIMESTAMPS
+#define AXMC_ENABLE_MESSAGE_TIMESTAMPS 0
+#endif
+
+/**
+ * @def AXMC_MAXIMUM_TRANSMITTED_PAYLOAD_SIZE
+ * @brief Determines the maximum size, in bytes, of the message payloads sent to the PC.
+ *
+ * The value is automatically limited to the largest payload supported by the serial buffer of the host
+ * microcontroller and cannot exceed 254 bytes. By default, uses the largest supported payload size. Decreasing this
+ * value (for example, via the '-D AXMC_MAXIMUM_TRANSMITTED_PAYLOAD_SIZE=64' build flag) reduces the RAM used by the
+ * transmission buffer, but also limits the size of the data objects that can be sent to the PC.
+ */
+#ifndef AXMC_MAXIMUM_TRANSMITTED_PAYLOAD_SIZE
+#define AXMC_MAXIMUM_TRANSMITTED_PAYLOAD_SIZE 254
+#endif
+
+/**
+ * @def AXMC_MAXIMUM_RECEIVED_PAYLOAD_SIZE
+ * @brief Determines the maximum size, in bytes, of the message payloads received from the PC.
+ *
+ * The value is automatically limited to the largest payload supported by the serial buffer of the host
+ * microcontroller and cannot exceed 254 bytes. By default, uses the largest supported payload size. Decreasing this
+ * value (for example, via the '-D AXMC_MAXIMUM_RECEIVED_PAYLOAD_SIZE=32' build flag) reduces the RAM used by the
+ * reception buffer, but also limits the size of the module parameter structures that can be received from the PC.
+ */
+#ifndef AXMC_MAXIMUM_RECEIVED_PAYLOAD_SIZE
+#define AXMC_MAXIMUM_RECEIVED_PAYLOAD_SIZE 254
+#endif
+
+/**
+ * @def AXMC_CRC_WIDTH
+ * @brief Determines the width, in bits, of the CRC checksum used to verify the integrity of the exchanged messages.
+ *
+ * Supported values are 8, 16, and 32. By default, uses the 16-bit CRC-CCITT checksum (polynomial 0x1021, initial value
+ * 0xFFFF, no final XOR). The 8-bit checksum uses the 0x07 polynomial with initial and final XOR values of 0x00, and the
+ * 32-bit checksum uses the 0x04C11DB7 polynomial with initial and final XOR values of 0xFFFFFFFF. Use the
+ * AXMC_CRC_POLYNOMIAL, AXMC_CRC_INITIAL_VALUE, and AXMC_CRC_FINAL_XOR_VALUE build flags to override these parameters.
+ *
+ * @warning The PC has to use the same checksum parameters to communicate with the microcontroller.
+ */
+#ifndef AXMC_CRC_WIDTH
+#define AXMC_CRC_WIDTH 16
+#endif
+
+#if AXMC_CRC_WIDTH == 8
+#ifndef AXMC_CRC_POLYNOMIAL
+#define AXMC_CRC_POLYNOMIAL 0x07
+#endif
+#ifndef AXMC_CRC_INITIAL_VALUE
+#define AXMC_CRC_INITIAL_VALUE 0x00
+#endif
+#ifndef AXMC_CRC_FINAL_XOR_VALUE
+#define AXMC_CRC_FINAL_XOR_VALUE 0x00
+#endif
+#elif AXMC_CRC_WIDTH == 16
+#ifndef AXMC_CRC_POLYNOMIAL
+#define AXMC_CRC_POLYNOMIAL 0x1021
+#endif
+#ifndef AXMC_CRC_INITIAL_VALUE
+#define AXMC_CRC_INITIAL_VALUE 0xFFFF
+#endif
+#ifndef AXMC_CRC_FINAL_XOR_VALUE
+#define AXMC_CRC_FINAL_XOR_VALUE 0x0000
+#endif
+#elif AXMC_CRC_WIDTH == 32
+#ifndef AXMC_CRC_POLYNOMIAL
+#define AXMC_CRC_POLYNOMIAL 0x04C11DB7
+#endif
+#ifndef AXMC_CRC_INITIAL_VALUE
+#define AXMC_CRC_INITIAL_VALUE 0xFFFFFFFF
+#endif
+#ifndef AXMC_CRC_FINAL_XOR_VALUE
+#define AXMC_CRC_FINAL_XOR_VALUE 0xFFFFFFFF
+#endif
+#else
+#error "Unsupported AXMC_CRC_WIDTH value. Use 8, 16, or 32."
+#endif
+
+/**
+ * @def AXMC_COMMUNICATION_RAM_BUDGET
+ * @brief Determines the maximum amount of RAM, in bytes, the Communication class instance is allowed to use.
+ *
+ * The size of the Communication instance is checked against this budget at compile time, which prevents the
+ * communication buffers from silently consuming the RAM needed by the managed modules. By default, the budget is 1024
+ * bytes on AVR boards (such as Arduino Mega) and 4096 bytes on all other boards. Override the budget (for example, via
+ * the '-D AXMC_COMMUNICATION_RAM_BUDGET=2048' build flag) if the project intentionally uses larger buffers.
+ */
+#ifndef AXMC_COMMUNICATION_RAM_BUDGET
+#if defined(__AVR__)
+#define AXMC_COMMUNICATION_RAM_BUDGET 1024
+#else
+#define AXMC_COMMUNICATION_RAM_BUDGET 4096
+#endif
+#endif
+
+/**
+ * @brief Buffers the data written to the wrapped communication port and transfers it to the port without blocking.
+ *
+ * This class is used by the Communication class to implement the asynchronous transmission mode. It forwards all
+ * reading operations to the wrapped port, but stores all written data in a fixed-size ring buffer. The buffered
+ * data is written to the port via the Drain() method, which only writes as many bytes as the port can accept
+ * without blocking.
+ *
+ * @tparam kCapacity The size of the ring buffer, in bytes.
+ */
+template <const uint16_t kCapacity>
+class TransmissionBuffer final : public Stream
+{
+        static_assert(kCapacity > 0, "The TransmissionBuffer capacity has to be greater than 0 bytes.");
+
+    public:
+        /// Initializes the ring buffer that wraps the input communication port.
+        explicit TransmissionBuffer(Stream& communication_port) : _port(communication_port)
+        {}
+
+        /// Returns the number of bytes available for reading from the wrapped communication port.
+        int available() override
+        {
+            return _port.available();
+        }
+
+        /// Reads a byte from the wrapped communication port.
+        int read() override
+        {
+            return _port.read();
+        }
+
+        /// Returns the next byte available for reading from the wrapped communication port without consuming it.
+        int peek() override
+        {
+            return _port.peek();
+        }
+
+        /// Writes the input byte to the ring buffer. Returns 0 if the ring buffer is full.
+        size_t write(const uint8_t data) override
+        {
+            if (_size == kCapacity)
+            {
+                _frame_overflow = true;
+                return 0;
+            }
+
+            _buffer[_head] = data;
+            _head          = static_cast<uint16_t>((_head + 1) % kCapacity);
+            _size++;
+            return 1;
+        }
+
+        /// Writes the input byte array to the ring buffer. Returns the number of bytes written to the buffer.
+        size_t write(const uint8_t* data, const size_t size) override
+        {
+            size_t written = 0;
+            while (written < size && write(data[written]) == 1) written++;
+            return written;
+        }
+
+        /// Returns the number of bytes that can be written to the ring buffer.
+        int availableForWrite() override
+        {
+            return kCapacity - _size;
+        }
+
+        /// Marks the beginning of a new message frame.
+        void BeginFrame()
+        {
+            _frame_head     = _head;
+            _frame_size     = _size;
+            _frame_overflow = false;
+        }
+
+        /**
+         * @brief Marks the end of the current message frame.
+         *
+         * If the frame did not fit into the ring buffer, discards the already buffered part of the frame to
+         * prevent transmitting incomplete message frames and increments the overflow counter.
+         *
+         * @returns true if the whole frame was buffered, false otherwise.
+         */
+        bool EndFrame()
+        {
+            if (!_frame_overflow) return true;
+
+            _head = _frame_head;
+            _size = _frame_size;
+            _overflow_count++;
+            return false;
+        }
+
+        /// Writes as many buffered bytes to the wrapped communication port as it can accept without blocking.
+        void Drain()
+        {
+            int writable = _port.availableForWrite();
+            while (_size > 0 && writable > 0)
+            {
+                // Writes the buffered data in contiguous chunks, which requires splitting the data at the end of the
+                // ring buffer.
+                const uint16_t contiguous = min(_size, static_cast<uint16_t>(kCapacity - _tail));
+                const auto chunk          = static_cast<uint16_t>(min(contiguous, static_cast<uint16_t>(writable)));
+                const size_t written      = _port.write(&_buffer[_tail], chunk);
+                if (written == 0) return;
+
+                _tail     = static_cast<uint16_t>((_tail + written) % kCapacity);
+                _size     = static_cast<uint16_t>(_size - written);
+                writable -= static_cast<int>(written);
+            }
+        }
+
+        /// Returns the number of message frames discarded due to the ring buffer running out of space.
+        [[nodiscard]]
+        uint32_t get_overflow_count() const
+        {
+            return _overflow_count;
+        }
+
+        using Print::write;
+
+    private:
+        /// Stores the wrapped communication port.
+        Stream& _port;
+
+        /// Stores the buffered data.
+        uint8_t _buffer[kCapacity] = {};  // NOLINT(*-avoid-c-arrays)
+
+        /// Stores the index at which the next written byte is stored.
+        uint16_t _head = 0;
+
+        /// Stores the index of the oldest buffered byte.
+        uint16_t _tail = 0;
+
+        /// Stores the number of buffered bytes.
+        uint16_t _size = 0;
+
+        /// Stores the value of the head index at the beginning of the current message frame.
+        uint16_t _frame_head = 0;
+
+        /// Stores the number of buffered bytes at the beginning of the current message frame.
+        uint16_t _frame_size = 0;
+
+        /// Determines whether the current message frame did not fit into the ring buffer.
+        bool _frame_overflow = false;
+
+        /// Stores the number of message frames discarded due to the ring buffer running out of space.
+        uint32_t _overflow_count = 0;
+};
+
 /**
  * @brief Exposes methods that allow exchanging data with a host-computer (PC) running the
  * ataraxis-communication-interface library.
@@ -35,6 +322,38 @@ using namespace axmc_communication_assets;
 class Communication
 {
     public:
+#if AXMC_ENABLE_MESSAGE_TIMESTAMPS
+        /// The headers used by the Module and Kernel data and state messages.
+        using ModuleDataHeader  = TimestampedModuleData;
+        using KernelDataHeader  = TimestampedKernelData;
+        using ModuleStateHeader = TimestampedModuleState;
+        using KernelStateHeader = TimestampedKernelState;
+#else
+        /// The headers used by the Module and Kernel data and state messages.
+        using ModuleDataHeader  = ModuleData;
+        using KernelDataHeader  = KernelData;
+        using ModuleStateHeader = ModuleState;
+        using KernelStateHeader = KernelState;
+#endif
+
+        /**
+         * @brief Stores a pre-serialized Module data message.
+         *
+         * The header of the prepared message is constructed once, when the message is prepared, and the message is
+         * written to the transmission buffer as a single contiguous object when it is sent.
+         *
+         * @tparam ObjectType The type of the data object sent with the message.
+         */
+        template <typename ObjectType>
+        struct PreparedDataMessage
+        {
+                ModuleDataHeader header;  ///< The message header.
+                ObjectType object;        ///< The data object sent with the message.
+        } PACKED_STRUCT;
+
+        /// Stores a pre-serialized Module state message.
+        using PreparedStateMessage = ModuleStateHeader;
+
         /**
          * @brief Instantiates a specialized TransportLayer instance to handle the microcontroller-PC communication.
          *
@@ -42,13 +361,24 @@ class Communication
          * number may be lowered up to ~700 bytes due to adaptive optimization.
          *
          * @param communication_port The initialized communication interface instance, such as Serial or USB Serial.
+         * @param batch_age_limit The maximum time, in microseconds, a batched message payload is allowed to accumulate
+         * Module and Kernel data and state messages before it is sent to the PC. Setting this parameter to 0 disables
+         * message batching, so that each message is sent to the PC as soon as it is packaged.
          */
-        explicit Communication(Stream& communication_port) :
+        explicit Communication(Stream& communication_port, const uint32_t batch_age_limit = 0) :
+            _batch_age_limit(batch_age_limit),
+#if AXMC_TRANSMISSION_BUFFER_SIZE > 0
+            _transmission_buffer(communication_port),
+            _transport_layer(
+                _transmission_buffer,  // Stream
+#else
+            _communication_port(communication_port),
             _transport_layer(
                 communication_port,  // Stream
-                0x1021,              // 16-bit CRC Polynomial
-                0xFFFF,              // Initial CRC value
-                0x0000               // Final CRC XOR value
+#endif
+                static_cast<CrcType>(AXMC_CRC_POLYNOMIAL),       // CRC Polynomial
+                static_cast<CrcType>(AXMC_CRC_INITIAL_VALUE),    // Initial CRC value
+                static_cast<CrcType>(AXMC_CRC_FINAL_XOR_VALUE)   // Final CRC XOR value
             )
         {}
 
@@ -78,39 +408,80 @@ class Communication
             _protocol_code = code;
         }
 
-        /// Returns the last received Module-addressed recurrent (repeated) command message data.
+        /// Returns the last received Module-addressed recurrent (repeated) command message data. Only valid if the last
+        /// received message uses the kRepeatedModuleCommand protocol.
         [[nodiscard]]
         const RepeatedModuleCommand& get_repeated_module_command() const
         {
-            return _repeated_module_command;
+            return _received_message.repeated_module_command;
         }
 
-        /// Returns the last received Module-addressed non-recurrent (one-off) command message data.
+        /// Returns the last received Module-addressed non-recurrent (one-off) command message data. Only valid if the
+        /// last received message uses the kOneOffModuleCommand protocol.
         [[nodiscard]]
         const OneOffModuleCommand& get_one_off_module_command() const
         {
-            return _one_off_module_command;
+            return _received_message.one_off_module_command;
         }
 
-        /// Returns the last received Kernel-addressed command message data.
+#if AXMC_ENABLE_MESSAGE_TIMESTAMPS
+        /// Returns the last received Module-addressed scheduled one-off command message data. Only valid if the last
+        /// received message uses the kScheduledModuleCommand protocol.
+        [[nodiscard]]
+        const ScheduledModuleCommand& get_scheduled_module_command() const
+        {
+            return _received_message.scheduled_module_command;
+        }
+#endif
+
+        /// Returns the last received Kernel-addressed command message data. Only valid if the last received message
+        /// uses the kKernelCommand protocol.
         [[nodiscard]]
         const KernelCommand& get_kernel_command() const
         {
-            return _kernel_command;
+            return _received_message.kernel_command;
         }
 
-        /// Returns the last received Module-addressed dequeue command message data.
+        /// Returns the last received Module-addressed dequeue command message data. Only valid if the last received
+        /// message uses the kDequeueModuleCommand protocol.
         [[nodiscard]]
         const DequeueModuleCommand& get_module_dequeue() const
         {
-            return _module_dequeue;
+            return _received_message.module_dequeue;
+        }
+
+        /// Returns the last received command sequence program message header data. Only valid if the last received
+        /// message uses the kSequenceProgram protocol.
+        [[nodiscard]]
+        const SequenceProgram& get_sequence_program_header() const
+        {
+            return _received_message.sequence_program_header;
         }
 
-        /// Returns the last received Module-addressed parameters message header data.
+        /// Returns the last received Module-addressed parameters message header data. Only valid if the last received
+        /// message uses the kModuleParameters or the kPartialModuleParameters protocol.
         [[nodiscard]]
         const ModuleParameters& get_module_parameters_header() const
         {
-            return _module_parameters_header;
+            // Since both parameter message headers start with the same fields, the addressing data of the partial
+            // parameters messages is accessible through the full parameters message header.
+            return _received_message.module_parameters_header;
+        }
+
+        /// Returns the last received Module-addressed partial parameters message header data. Only valid if the last
+        /// received message uses the kPartialModuleParameters protocol.
+        [[nodiscard]]
+        const PartialModuleParameters& get_partial_module_parameters_header() const
+        {
+            return _received_message.partial_module_parameters_header;
+        }
+
+        /// Returns the last received Module-addressed event limit message data. Only valid if the last received
+        /// message uses the kModuleEventLimit protocol.
+        [[nodiscard]]
+        const ModuleEventLimit& get_module_event_limit() const
+        {
+            return _received_message.module_event_limit;
         }
 
         /// Returns the most recent TransportLayer's status code.
@@ -136,7 +507,7 @@ class Communication
          * @param event_code The event that triggered the message.
          * @param object The data payload appended to the message after the header.
          *
-         * @returns true if the message is sent, false otherwise.
+         * @returns true if the message is sent or batched, false otherwise.
          */
         template <typename ObjectType>
         bool SendDataMessage(
@@ -149,14 +520,19 @@ class Communication
         {
             // Ensures that the input fits inside the message payload buffer.
             static_assert(
-                sizeof(ObjectType) <= kMaximumPayloadSize - sizeof(ModuleData),
+                sizeof(ObjectType) <= kMaximumTransmittedPayloadSize - sizeof(ModuleDataHeader),
                 "The provided object is too large to fit inside the message payload buffer. This check accounts for "
                 "the size of the ModuleData header sent with the object."
             );
 
             // Constructs the message header. The prototype code is resolved at compile time from ObjectType.
-            const ModuleData message {
+            const ModuleDataHeader message {
+#if AXMC_ENABLE_MESSAGE_TIMESTAMPS
+                static_cast<uint8_t>(kProtocols::kTimestampedModuleData),
+                GetTimestamp(),
+#else
                 static_cast<uint8_t>(kProtocols::kModuleData),
+#endif
                 module_type,
                 module_id,
                 command,
@@ -164,6 +540,9 @@ class Communication
                 static_cast<uint8_t>(ResolvePrototype<ObjectType>())
             };
 
+            // If message batching is enabled, ensures that the open batch has enough space to store the message.
+            const bool batched = ReserveBatchSpace(sizeof(message) + sizeof(ObjectType));
+
             // Writes the message to the transmission buffer.
             bool success = true;
             if (!_transport_layer.WriteData(message)) success = false;
@@ -176,10 +555,8 @@ class Communication
                 return false;
             }
 
-            // If the data was written to the buffer, sends it to the PC.
-            _transport_layer.SendData();
-            _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kMessageSent);
-            return true;
+            // If the data was written to the buffer, sends it to the PC or appends it to the open batch.
+            return FinalizeMessage(batched, sizeof(message) + sizeof(ObjectType));
         }
 
         /**
@@ -193,26 +570,34 @@ class Communication
          * @param event_code The event that triggered the message.
          * @param object The data payload appended to the message after the header.
          *
-         * @returns true if the message is sent, false otherwise.
+         * @returns true if the message is sent or batched, false otherwise.
          */
         template <typename ObjectType>
         bool SendDataMessage(const uint8_t command, const uint8_t event_code, const ObjectType& object)
         {
             // Ensures that the input fits inside the message payload buffer.
             static_assert(
-                sizeof(ObjectType) <= kMaximumPayloadSize - sizeof(KernelData),
+                sizeof(ObjectType) <= kMaximumTransmittedPayloadSize - sizeof(KernelDataHeader),
                 "The provided object is too large to fit inside the message payload buffer. This check accounts for "
                 "the size of the KernelData header sent with the object."
             );
 
             // Constructs the message header. The prototype code is resolved at compile time from ObjectType.
-            const KernelData message {
+            const KernelDataHeader message {
+#if AXMC_ENABLE_MESSAGE_TIMESTAMPS
+                static_cast<uint8_t>(kProtocols::kTimestampedKernelData),
+                GetTimestamp(),
+#else
                 static_cast<uint8_t>(kProtocols::kKernelData),
+#endif
                 command,
                 event_code,
                 static_cast<uint8_t>(ResolvePrototype<ObjectType>())
             };
 
+            // If message batching is enabled, ensures that the open batch has enough space to store the message.
+            const bool batched = ReserveBatchSpace(sizeof(message) + sizeof(ObjectType));
+
             // Writes the message to the transmission buffer.
             bool success = true;
             if (!_transport_layer.WriteData(message)) success = false;
@@ -225,10 +610,8 @@ class Communication
                 return false;
             }
 
-            // If the data was written to the buffer, sends it to the PC.
-            _transport_layer.SendData();
-            _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kMessageSent);
-            return true;
+            // If the data was written to the buffer, sends it to the PC or appends it to the open batch.
+            return FinalizeMessage(batched, sizeof(message) + sizeof(ObjectType));
         }
 
         /**
@@ -241,7 +624,7 @@ class Communication
          * @param command The command executed by the module that sent the message.
          * @param event_code The event that triggered the message.
          *
-         * @returns true if the message is sent, false otherwise.
+         * @returns true if the message is sent or batched, false otherwise.
          */
         bool SendStateMessage(
             const uint8_t module_type,
@@ -251,8 +634,21 @@ class Communication
         )
         {
             // Constructs the message header.
-            const ModuleState
-                message {static_cast<uint8_t>(kProtocols::kModuleState), module_type, module_id, command, event_code};
+            const ModuleStateHeader message {
+#if AXMC_ENABLE_MESSAGE_TIMESTAMPS
+                static_cast<uint8_t>(kProtocols::kTimestampedModuleState),
+                GetTimestamp(),
+#else
+                static_cast<uint8_t>(kProtocols::kModuleState),
+#endif
+                module_type,
+                module_id,
+                command,
+                event_code
+            };
+
+            // If message batching is enabled, ensures that the open batch has enough space to store the message.
+            const bool batched = ReserveBatchSpace(sizeof(message));
 
             // Writes the message into the payload buffer. If writing fails, breaks the runtime with an error status.
             if (!_transport_layer.WriteData(message))
@@ -261,10 +657,8 @@ class Communication
                 return false;
             }
 
-            // If the data was written to the buffer, sends it to the PC.
-            _transport_layer.SendData();
-            _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kMessageSent);
-            return true;
+            // If the data was written to the buffer, sends it to the PC or appends it to the open batch.
+            return FinalizeMessage(batched, sizeof(message));
         }
 
         /**
@@ -273,12 +667,24 @@ class Communication
          * @param command The command the Kernel was executing when it sent the message.
          * @param event_code The event that triggered the message.
          *
-         * @returns true if the message is sent, false otherwise.
+         * @returns true if the message is sent or batched, false otherwise.
          */
         bool SendStateMessage(const uint8_t command, const uint8_t event_code)
         {
             // Constructs the message header.
-            const KernelState message {static_cast<uint8_t>(kProtocols::kKernelState), command, event_code};
+            const KernelStateHeader message {
+#if AXMC_ENABLE_MESSAGE_TIMESTAMPS
+                static_cast<uint8_t>(kProtocols::kTimestampedKernelState),
+                GetTimestamp(),
+#else
+                static_cast<uint8_t>(kProtocols::kKernelState),
+#endif
+                command,
+                event_code
+            };
+
+            // If message batching is enabled, ensures that the open batch has enough space to store the message.
+            const bool batched = ReserveBatchSpace(sizeof(message));
 
             // Writes the message into the payload buffer. If writing fails, breaks the runtime with an error status.
             if (!_transport_layer.WriteData(message))
@@ -287,10 +693,257 @@ class Communication
                 return false;
             }
 
-            // If the data was written to the buffer, sends it to the PC.
-            _transport_layer.SendData();
-            _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kMessageSent);
-            return true;
+            // If the data was written to the buffer, sends it to the PC or appends it to the open batch.
+            return FinalizeMessage(batched, sizeof(message));
+        }
+
+        /// Returns the maximum size, in bytes, of the data object that can be sent as part of a single Module data
+        /// message.
+        [[nodiscard]]
+        static constexpr size_t get_maximum_module_object_size()
+        {
+            return kMaximumTransmittedPayloadSize - sizeof(ModuleDataHeader);
+        }
+
+        /// Returns the maximum size, in bytes, of the parameter object that can be received as part of a single
+        /// ModuleParameters message.
+        [[nodiscard]]
+        static constexpr size_t get_maximum_parameters_size()
+        {
+            return kMaximumParameterSize;
+        }
+
+        /// Returns the maximum number of the command sequence program steps that can be received as part of a single
+        /// SequenceProgram message.
+        [[nodiscard]]
+        static constexpr size_t get_maximum_sequence_step_count()
+        {
+            // The '-1' accounts for the protocol code that precedes the message header.
+            return (kMaximumReceivedPayloadSize - sizeof(SequenceProgram) - 1) / sizeof(SequenceStep);
+        }
+
+        /// Returns the maximum size, in bytes, of the payload that can be sent as part of a single message. Accounts
+        /// for the serial buffer size of the host microcontroller.
+        [[nodiscard]]
+        static constexpr size_t get_maximum_transmitted_payload_size()
+        {
+            return kMaximumTransmittedPayloadSize;
+        }
+
+        /**
+         * @brief Constructs the prepared Module data message that communicates the input event code and a data object
+         * of the specified type.
+         *
+         * @tparam ObjectType The type of the data object sent with the message.
+         * @param module_type The type of the module that sends the message.
+         * @param module_id The ID of the specific module instance that sends the message.
+         * @param event_code The event communicated by the message.
+         *
+         * @returns The prepared message. Use the SendPreparedMessage() method to send it to the PC.
+         */
+        template <typename ObjectType>
+        static PreparedDataMessage<ObjectType>
+        PrepareDataMessage(const uint8_t module_type, const uint8_t module_id, const uint8_t event_code)
+        {
+            // Ensures that the input fits inside the message payload buffer.
+            static_assert(
+                sizeof(PreparedDataMessage<ObjectType>) <= kMaximumTransmittedPayloadSize,
+                "The provided object is too large to fit inside the message payload buffer. This check accounts for "
+                "the size of the ModuleData header sent with the object."
+            );
+
+            PreparedDataMessage<ObjectType> message {};
+#if AXMC_ENABLE_MESSAGE_TIMESTAMPS
+            message.header.protocol = static_cast<uint8_t>(kProtocols::kTimestampedModuleData);
+#else
+            message.header.protocol = static_cast<uint8_t>(kProtocols::kModuleData);
+#endif
+            message.header.module_type = module_type;
+            message.header.module_id   = module_id;
+            message.header.event       = event_code;
+            message.header.prototype   = static_cast<uint8_t>(ResolvePrototype<ObjectType>());
+            return message;
+        }
+
+        /**
+         * @brief Constructs the prepared Module state message that communicates the input event code.
+         *
+         * @param module_type The type of the module that sends the message.
+         * @param module_id The ID of the specific module instance that sends the message.
+         * @param event_code The event communicated by the message.
+         *
+         * @returns The prepared message. Use the SendPreparedMessage() method to send it to the PC.
+         */
+        static PreparedStateMessage
+        PrepareStateMessage(const uint8_t module_type, const uint8_t module_id, const uint8_t event_code)
+        {
+            PreparedStateMessage message {};
+#if AXMC_ENABLE_MESSAGE_TIMESTAMPS
+            message.protocol = static_cast<uint8_t>(kProtocols::kTimestampedModuleState);
+#else
+            message.protocol = static_cast<uint8_t>(kProtocols::kModuleState);
+#endif
+            message.module_type = module_type;
+            message.module_id   = module_id;
+            message.event       = event_code;
+            return message;
+        }
+
+        /**
+         * @brief Sends the input prepared Module data or state message to the PC.
+         *
+         * Unlike the SendDataMessage() and SendStateMessage() methods, this method does not construct the message
+         * header. Instead, it updates the command code (and, if enabled, the timestamp) of the prepared header and
+         * writes the entire message to the transmission buffer as a single object.
+         *
+         * @tparam MessageType The type of the prepared message.
+         * @param message The prepared message to send. The data object of the prepared data messages has to be set
+         * before calling this method.
+         * @param command The command executed by the module that sends the message.
+         *
+         * @returns true if the message is sent or batched, false otherwise.
+         */
+        template <typename MessageType>
+        bool SendPreparedMessage(MessageType& message, const uint8_t command)
+        {
+            // Updates the variable portion of the header.
+            HeaderOf(message).command = command;
+#if AXMC_ENABLE_MESSAGE_TIMESTAMPS
+            HeaderOf(message).timestamp = GetTimestamp();
+#endif
+
+            // If message batching is enabled, ensures that the open batch has enough space to store the message.
+            const bool batched = ReserveBatchSpace(sizeof(message));
+
+            // Writes the message into the payload buffer. If writing fails, breaks the runtime with an error status.
+            if (!_transport_layer.WriteData(message))
+            {
+                _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kPackingError);
+                return false;
+            }
+
+            // If the data was written to the buffer, sends it to the PC or appends it to the open batch.
+            return FinalizeMessage(batched, sizeof(message));
+        }
+
+#if AXMC_ENABLE_MESSAGE_TIMESTAMPS
+        /**
+         * @brief Returns the controller time, in microseconds, extended to 64 bits.
+         *
+         * @warning To correctly extend the 32-bit microsecond timer, this method has to be called at least once per
+         * timer overflow period (~71 minutes). The Kernel calls this method once per runtime cycle.
+         */
+        uint64_t GetTimestamp()
+        {
+            const uint32_t now = micros();
+            if (now < _previous_micros) _micros_overflows++;
+            _previous_micros = now;
+            return static_cast<uint64_t>(_micros_overflows) << 32 | now;
+        }
+#endif
+
+        /**
+         * @brief Sends the open batched message payload to the PC.
+         *
+         * @note This method is called automatically when the open batch runs out of space or is about to be
+         * interleaved with a non-batched message. The Kernel calls the ResolveBatchedMessages() method at the end of
+         * each runtime cycle to send batches that exceed the configured age limit.
+         *
+         * @returns true if the batch is sent or if there is no open batch to send, false otherwise.
+         */
+        bool SendBatchedMessages()
+        {
+            // If there is no open batch, there is nothing to send.
+            if (_batch_size == 0) return true;
+
+            // Sends the accumulated batch to the PC and closes the batch.
+            _batch_size = 0;
+            return TransmitPayload();
+        }
+
+        /**
+         * @brief Sends the open batched message payload to the PC if it has exceeded the configured age limit.
+         *
+         * @returns true if there is no batch that needs to be sent or the batch is sent, false otherwise.
+         */
+        bool ResolveBatchedMessages()
+        {
+            if (_batch_size == 0 || _batch_timer < _batch_age_limit) return true;
+            return SendBatchedMessages();
+        }
+
+        /**
+         * @brief Writes as many buffered message frames to the communication port as it can accept without blocking.
+         *
+         * @note This method is called by the Kernel once per runtime cycle. If the instance is compiled with the
+         * asynchronous transmission mode disabled, this method does nothing.
+         */
+        void SendBufferedData()
+        {
+#if AXMC_TRANSMISSION_BUFFER_SIZE > 0
+            _transmission_buffer.Drain();
+#endif
+        }
+
+        /// Returns the number of message frames discarded due to the transmission ring buffer running out of space.
+        [[nodiscard]]
+        uint32_t get_transmission_buffer_overflows() const
+        {
+#if AXMC_TRANSMISSION_BUFFER_SIZE > 0
+            return _transmission_buffer.get_overflow_count();
+#else
+            return 0;
+#endif
+        }
+
+        /// Returns true if the communication port has received data that was not yet processed by the
+        /// ReceiveMessage() method.
+        [[nodiscard]]
+        bool is_data_available()
+        {
+#if AXMC_TRANSMISSION_BUFFER_SIZE > 0
+            return _transmission_buffer.available() > 0;
+#else
+            return _communication_port.available() > 0;
+#endif
+        }
+
+        /**
+         * @brief Determines whether a droppable message of the specified size can be sent to the PC without blocking
+         * and without using the transmission headroom reserved for the critical messages.
+         *
+         * @warning If the asynchronous transmission mode is disabled, this method relies on the communication port
+         * reporting its free transmission buffer space via the availableForWrite() method. Ports that do not implement
+         * this method report no free space, causing all droppable messages to be dropped.
+         *
+         * @param message_size The size of the message, in bytes, including the message header and data object.
+         *
+         * @returns true if the message can be sent, false if it has to be dropped.
+         */
+        [[nodiscard]]
+        bool HasTransmissionHeadroom(const size_t message_size)
+        {
+            // If message batching is enabled, the message is transmitted as part of the batched message payload.
+            // Mirrors the ReserveBatchSpace() method: the message either joins the open batch, whose size already
+            // includes the batch protocol code, or starts a new batch, for which the '+1' accounts for the batch
+            // protocol code. Messages that are too large to be batched are sent as standalone messages.
+            size_t payload_size = message_size;
+            if (_batch_age_limit != 0 && message_size + 1 <= kMaximumTransmittedPayloadSize)
+            {
+                const bool joins_open_batch =
+                    _batch_size != 0 && _batch_size + message_size <= kMaximumTransmittedPayloadSize;
+                payload_size = joins_open_batch ? _batch_size + message_size : message_size + 1;
+            }
+
+            // The message frame adds 4 bytes of service data and the checksum to the payload.
+            const size_t frame_size = payload_size + 4 + sizeof(CrcType);
+
+#if AXMC_TRANSMISSION_BUFFER_SIZE > 0
+            const int writable = _transmission_buffer.availableForWrite();
+#else
+            const int writable = _communication_port.availableForWrite();
+#endif
+            return writable > 0 && static_cast<size_t>(writable) >= frame_size + AXMC_CRITICAL_MESSAGE_HEADROOM;
         }
 
         /**
@@ -311,14 +964,42 @@ class Communication
             const uint8_t error_code
         )
         {
-            // Combines the latest statuses of the Communication class and the TransportLayer class into a 2-byte array.
-            // Jointly, this information should be enough to diagnose the error.
-            const uint8_t errors[2] = {_communication_status, _transport_layer.get_runtime_status()};
+            SendCommunicationErrorMessage(module_type, module_id, command, error_code, *this);
+        }
+
+        /**
+         * @brief Overloads the SendCommunicationErrorMessage() method to report the error encountered by a different
+         * Communication instance, such as the bulk-data channel, via this instance.
+         *
+         * @param module_type The type of the module that sent the message.
+         * @param module_id The ID of the specific module instance that sent the message.
+         * @param command The command executed by the module that sent the message.
+         * @param error_code The encountered communication error.
+         * @param failed_channel The Communication instance that encountered the error. The error message communicates
+         * the statuses of this instance.
+         */
+        void SendCommunicationErrorMessage(
+            const uint8_t module_type,
+            const uint8_t module_id,
+            const uint8_t command,
+            const uint8_t error_code,
+            const Communication& failed_channel
+        )
+        {
+            // Combines the latest statuses of the failed Communication class and its TransportLayer class into a 2-byte
+            // array. Jointly, this information should be enough to diagnose the error.
+            const uint8_t errors[2] = {
+                failed_channel._communication_status,
+                failed_channel._transport_layer.get_runtime_status(),
+            };
 
             // Attempts sending the error message. Does not evaluate the status of sending the error message to avoid
             // recursions.
             SendDataMessage(module_type, module_id, command, error_code, errors);
 
+            // Ensures that error messages are not delayed by message batching.
+            SendBatchedMessages();
+
             // As a fallback in case the error message does not reach the connected system, activates the built-in LED.
             // The LED is used as a visual indicator for a potentially unhandled runtime error. The Kernel class manages
             // the indicator inactivation.
@@ -342,6 +1023,9 @@ class Communication
             // recursions.
             SendDataMessage(command, error_code, errors);
 
+            // Ensures that error messages are not delayed by message batching.
+            SendBatchedMessages();
+
             // As a fallback in case the error message does not reach the connected system, activates the built-in LED.
             // The LED is used as a visual indicator for a potentially unhandled runtime error. The Kernel class manages
             // the indicator inactivation.
@@ -378,6 +1062,10 @@ class Communication
                 "uint32_t service codes are supported."
             );
 
+            // Service messages are never batched. If there is an open batch, sends it to the PC first to preserve the
+            // order of the transmitted messages.
+            SendBatchedMessages();
+
             // Packages the input protocol code and the service code into the transmission buffer.
             bool success = true;
             if (!_transport_layer.WriteData(static_cast<uint8_t>(kProtocol))) success = false;
@@ -391,9 +1079,41 @@ class Communication
             }
 
             // If the data was written to the buffer, sends it to the PC.
-            _transport_layer.SendData();
-            _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kMessageSent);
-            return true;
+            return TransmitPayload();
+        }
+
+        /**
+         * @brief Sends the input reception codes to the PC as a single kReceptionCodes service message.
+         *
+         * The message payload stores the number of transmitted reception codes as an uint8 value, followed by the
+         * reception codes in the order in which the acknowledged messages were received.
+         *
+         * @param codes The array of reception codes to be transmitted to the PC.
+         * @param code_count The number of reception codes stored in the input array.
+         *
+         * @returns true if the message is sent, false otherwise.
+         */
+        bool SendReceptionCodes(const uint8_t* codes, const uint8_t code_count)
+        {
+            // Service messages are never batched. If there is an open batch, sends it to the PC first to preserve the
+            // order of the transmitted messages.
+            SendBatchedMessages();
+
+            // Packages the protocol code, the number of reception codes, and the reception codes into the
+            // transmission buffer.
+            bool success = _transport_layer.WriteData(static_cast<uint8_t>(kProtocols::kReceptionCodes)) &&
+                           _transport_layer.WriteData(code_count);
+            for (uint8_t i = 0; success && i < code_count; i++) success = _transport_layer.WriteData(codes[i]);
+
+            // If serializing the message fails, breaks the runtime with an error status.
+            if (!success)
+            {
+                _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kPackingError);
+                return false;
+            }
+
+            // If the data was written to the buffer, sends it to the PC.
+            return TransmitPayload();
         }
 
         /**
@@ -429,6 +1149,9 @@ class Communication
                 return false;
             }
 
+            // The parameter data buffered for the previous message does not apply to the newly received message.
+            _buffered_parameter_size = 0;
+
             // If the message is received and decoded, extracts the protocol code of the received message and uses
             // it to parse the rest of the message.
             if (_transport_layer.ReadData(_protocol_code))
@@ -438,26 +1161,48 @@ class Communication
                 switch (static_cast<kProtocols>(_protocol_code))
                 {
                     case kProtocols::kRepeatedModuleCommand:
-                        if (_transport_layer.ReadData(_repeated_module_command)) return true;
+                        if (_transport_layer.ReadData(_received_message.repeated_module_command)) return true;
                         break;
 
                     case kProtocols::kOneOffModuleCommand:
-                        if (_transport_layer.ReadData(_one_off_module_command)) return true;
+                        if (_transport_layer.ReadData(_received_message.one_off_module_command)) return true;
                         break;
 
+#if AXMC_ENABLE_MESSAGE_TIMESTAMPS
+                    case kProtocols::kScheduledModuleCommand:
+                        if (_transport_layer.ReadData(_received_message.scheduled_module_command)) return true;
+                        break;
+#endif
+
                     case kProtocols::kDequeueModuleCommand:
-                        if (_transport_layer.ReadData(_module_dequeue)) return true;
+                        if (_transport_layer.ReadData(_received_message.module_dequeue)) return true;
                         break;
 
                     case kProtocols::kKernelCommand:
-                        if (_transport_layer.ReadData(_kernel_command)) return true;
+                        if (_transport_layer.ReadData(_received_message.kernel_command)) return true;
                         break;
 
                     case kProtocols::kModuleParameters:
                         // Reads the HEADER of the message into the storage structure. This gives the Kernel class
                         // enough information to address the message, but this is NOT the whole message. To retrieve
                         // the parameter data bundled with the message, use the ExtractModuleParameters() method.
-                        if (_transport_layer.ReadData(_module_parameters_header)) return true;
+                        if (_transport_layer.ReadData(_received_message.module_parameters_header)) return true;
+                        break;
+
+                    case kProtocols::kPartialModuleParameters:
+                        // Similar to the ModuleParameters messages, only reads the HEADER of the message. The parameter
+                        // bytes bundled with the message are also retrieved via the ExtractModuleParameters() method.
+                        if (_transport_layer.ReadData(_received_message.partial_module_parameters_header)) return true;
+                        break;
+
+                    case kProtocols::kModuleEventLimit:
+                        if (_transport_layer.ReadData(_received_message.module_event_limit)) return true;
+                        break;
+
+                    case kProtocols::kSequenceProgram:
+                        // Similar to the ModuleParameters messages, only reads the HEADER of the message. To retrieve
+                        // the sequence steps bundled with the message, use the ExtractSequenceSteps() method.
+                        if (_transport_layer.ReadData(_received_message.sequence_program_header)) return true;
                         break;
 
                     default:
@@ -476,6 +1221,9 @@ class Communication
          * @brief Extracts the parameter data payload transmitted with the last received ModuleParameters message into
          * the destination object's memory.
          *
+         * If the last received message is a PartialModuleParameters message, the method only overwrites the range of
+         * the destination object's bytes addressed by the message and leaves all other bytes unchanged.
+         *
          * @warning This method is intended to be called by end users as part of the SetCustomParameters() virtual
          * method implementation. Do not call this method from any other context.
          *
@@ -491,11 +1239,18 @@ class Communication
         {
             // Ensures that the prototype compiles with the limitations of the transport layer.
             static_assert(
-                kObjectSize > 0 && kObjectSize <= 250,
+                kObjectSize > 0 && kObjectSize <= get_maximum_parameters_size(),
                 "Unable to extract the target module's parameters as the method has received an invalid "
-                "'destination' input. A valid destination object must have a size between 1 and 250 bytes."
+                "'destination' input. A valid destination object must be at least 1 byte and fit into the received "
+                "ModuleParameters message payload (see the AXMC_MAXIMUM_RECEIVED_PAYLOAD_SIZE build flag)."
             );
 
+            // Partial parameter updates are resolved separately, as they only address a range of the object's bytes.
+            if (_protocol_code == static_cast<uint8_t>(kProtocols::kPartialModuleParameters))
+            {
+                return ExtractPartialModuleParameters(reinterpret_cast<uint8_t*>(&destination), kObjectSize);
+            }
+
             // Ensures this method cannot be called (successfully) unless the message currently stored in the reception
             // buffer is a ModuleParameters message.
             if (_protocol_code != static_cast<uint8_t>(kProtocols::kModuleParameters))
@@ -505,18 +1260,22 @@ class Communication
             }
 
             // Verifies that the size of the prototype structure exactly matches the number of object bytes received
-            // with the message. The '-1' accounts for the protocol code (first variable of each message) that precedes
-            // the message structure.
-            if (static_cast<uint8_t>(kObjectSize) !=
-                _transport_layer.get_bytes_in_reception_buffer() - sizeof(ModuleParameters) - 1)
+            // with the message.
+            if (kObjectSize != get_received_parameter_size())
             {
                 _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kParameterMismatch);
                 return false;
             }
 
-            // If both checks above are passed, extracts the parameter data from the incoming message into the provided
-            // structure (by reference).
-            if (!_transport_layer.ReadData(destination))
+            // If the parameter data was buffered for multiple modules, copies the data from the buffer.
+            if (_buffered_parameter_size != 0)
+            {
+                memcpy(&destination, _buffered_parameters, kObjectSize);
+            }
+
+            // Otherwise, if both checks above are passed, extracts the parameter data from the incoming message into
+            // the provided structure (by reference).
+            else if (!_transport_layer.ReadData(destination))
             {
                 _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kParsingError);
                 return false;
@@ -527,11 +1286,140 @@ class Communication
             return true;
         }
 
+        /**
+         * @brief Copies the parameter data transmitted with the last received ModuleParameters or
+         * PartialModuleParameters message into the internal buffer, so that multiple modules can extract the same data.
+         *
+         * Since extracting the parameters consumes the parameter data of the reception buffer, the Kernel buffers the
+         * data of the broadcast parameters messages before the addressed modules extract it. Until the next message is
+         * received, all ExtractModuleParameters() method calls extract the buffered data.
+         *
+         * @warning This method is intended to be called by the Kernel class. Do not call this method from any other
+         * context.
+         *
+         * @returns true if the parameter data was successfully buffered and false otherwise.
+         */
+        bool BufferModuleParameters()
+        {
+            if (_protocol_code != static_cast<uint8_t>(kProtocols::kModuleParameters) &&
+                _protocol_code != static_cast<uint8_t>(kProtocols::kPartialModuleParameters))
+            {
+                _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kExtractionForbidden);
+                return false;
+            }
+
+            const size_t parameter_size = get_received_parameter_size();
+            if (parameter_size == 0 || parameter_size > sizeof(_buffered_parameters))
+            {
+                _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kParameterMismatch);
+                return false;
+            }
+
+            for (size_t i = 0; i < parameter_size; i++)
+            {
+                if (!_transport_layer.ReadData(_buffered_parameters[i]))
+                {
+                    _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kParsingError);
+                    return false;
+                }
+            }
+
+            _buffered_parameter_size = static_cast<uint8_t>(parameter_size);
+            _communication_status    = static_cast<uint8_t>(kCommunicationStatusCodes::kParametersExtracted);
+            return true;
+        }
+
+        /**
+         * @brief Extracts the sequence steps transmitted with the last received SequenceProgram message into the
+         * destination array.
+         *
+         * @warning This method is intended to be called by the Kernel class. Do not call this method from any other
+         * context.
+         *
+         * @tparam kMaximumStepCount The number of steps the destination array can store.
+         * @param destination The array where to unpack the received sequence steps.
+         * @param step_count The variable where to store the number of extracted steps.
+         *
+         * @returns true if the sequence steps were successfully extracted into the destination array and false
+         * otherwise.
+         */
+        template <const size_t kMaximumStepCount>
+        bool ExtractSequenceSteps(
+            SequenceStep (&destination)[kMaximumStepCount],  // NOLINT(*-avoid-c-arrays)
+            uint8_t& step_count
+        )
+        {
+            static_assert(
+                kMaximumStepCount > 0 && kMaximumStepCount <= get_maximum_sequence_step_count(),
+                "Unable to extract the sequence steps as the method has received an invalid 'destination' input. A "
+                "valid destination array must store at least 1 step and no more steps than fit into the received "
+                "SequenceProgram message payload (see the AXMC_MAXIMUM_RECEIVED_PAYLOAD_SIZE build flag)."
+            );
+
+            if (_protocol_code != static_cast<uint8_t>(kProtocols::kSequenceProgram))
+            {
+                _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kExtractionForbidden);
+                return false;
+            }
+
+            // Verifies that the message stores a whole number of sequence steps that fits into the destination array.
+            // The '-1' accounts for the protocol code (first variable of each message) that precedes the message
+            // header.
+            const size_t step_bytes =
+                _transport_layer.get_bytes_in_reception_buffer() - sizeof(SequenceProgram) - 1;
+            if (step_bytes == 0 || step_bytes % sizeof(SequenceStep) != 0 ||
+                step_bytes / sizeof(SequenceStep) > kMaximumStepCount)
+            {
+                _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kParameterMismatch);
+                return false;
+            }
+
+            step_count = static_cast<uint8_t>(step_bytes / sizeof(SequenceStep));
+            for (size_t i = 0; i < step_count; i++)
+            {
+                if (!_transport_layer.ReadData(destination[i]))
+                {
+                    _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kParsingError);
+                    return false;
+                }
+            }
+
+            _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kParametersExtracted);
+            return true;
+        }
+
     private:
+        /// The type of the CRC checksum used to verify the integrity of the exchanged messages.
+#if AXMC_CRC_WIDTH == 8
+        using CrcType = uint8_t;
+#elif AXMC_CRC_WIDTH == 16
+        using CrcType = uint16_t;
+#else
+        using CrcType = uint32_t;
+#endif
+
         /// Defines the maximum possible size for the received and transmitted payloads. Reuses the
         /// kSerialBufferSize constant defined inside transport_layer.h to determine the serial buffer size of the
-        /// host microcontroller.
-        static constexpr uint8_t kMaximumPayloadSize = min(kSerialBufferSize - 6, 254);
+        /// host microcontroller. The message frame reserves 4 bytes for service data in addition to the checksum.
+        static constexpr uint8_t kMaximumPayloadSize =
+            min(kSerialBufferSize - (4 + static_cast<int>(sizeof(CrcType))), 254);
+
+        /// Defines the maximum size for the transmitted payloads.
+        static constexpr uint8_t kMaximumTransmittedPayloadSize =
+            min(AXMC_MAXIMUM_TRANSMITTED_PAYLOAD_SIZE, kMaximumPayloadSize);
+
+        /// Defines the maximum size for the received payloads.
+        static constexpr uint8_t kMaximumReceivedPayloadSize =
+            min(AXMC_MAXIMUM_RECEIVED_PAYLOAD_SIZE, kMaximumPayloadSize);
+
+        static_assert(
+            kMaximumReceivedPayloadSize >= sizeof(RepeatedModuleCommand) + 1,
+            "The AXMC_MAXIMUM_RECEIVED_PAYLOAD_SIZE is too small to receive the command messages."
+        );
+
+        /// Defines the maximum size of the parameter data received with a single ModuleParameters message. The '-1'
+        /// accounts for the protocol code that precedes the message header.
+        static constexpr size_t kMaximumParameterSize = kMaximumReceivedPayloadSize - sizeof(ModuleParameters) - 1;
 
         /// Stores the runtime status of the most recently called method.
         uint8_t _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kStandby);
@@ -539,23 +1427,246 @@ class Communication
         /// Stores the protocol code of the last received message.
         uint8_t _protocol_code = static_cast<uint8_t>(kProtocols::kUndefined);
 
-        /// Stores the last received Module-addressed recurrent (repeated) command message data.
-        RepeatedModuleCommand _repeated_module_command;
+        /// Stores the maximum age, in microseconds, of the open batched message payload. A value of 0 disables
+        /// message batching.
+        const uint32_t _batch_age_limit;
+
+        /// Stores the number of bytes, including the batch protocol code, written to the open batched message payload.
+        /// A value of 0 indicates that there is no open batch.
+        uint16_t _batch_size = 0;
 
-        /// Stores the last received Module-addressed non-recurrent (one-off) command message data.
-        OneOffModuleCommand _one_off_module_command;
+        /// Measures the age of the open batched message payload.
+        elapsedMicros _batch_timer;
 
-        /// Stores the last received Kernel-addressed command message data.
-        KernelCommand _kernel_command;
+#if AXMC_ENABLE_MESSAGE_TIMESTAMPS
+        /// Stores the microsecond timer value observed by the last GetTimestamp() method call.
+        uint32_t _previous_micros = 0;
 
-        /// Stores the last received Module-addressed dequeue command message data.
-        DequeueModuleCommand _module_dequeue;
+        /// Tracks the number of microsecond timer overflows, which provides the upper 32 bits of the timestamps.
+        uint32_t _micros_overflows = 0;
+#endif
 
-        /// Stores the last received Module-addressed parameters message header data.
-        ModuleParameters _module_parameters_header;
+        static_assert(
+            kMaximumTransmittedPayloadSize >= sizeof(ModuleDataHeader) + 2,
+            "The AXMC_MAXIMUM_TRANSMITTED_PAYLOAD_SIZE is too small to send the communication error messages."
+        );
+
+        /**
+         * @brief Stores the header data of the last received message.
+         *
+         * Since only the header matching the last received message's protocol code is valid at any time, all headers
+         * share the same memory.
+         */
+        union ReceivedMessage
+        {
+                RepeatedModuleCommand repeated_module_command;  ///< The Module-addressed recurrent command data.
+                OneOffModuleCommand one_off_module_command;     ///< The Module-addressed one-off command data.
+#if AXMC_ENABLE_MESSAGE_TIMESTAMPS
+                ScheduledModuleCommand scheduled_module_command;  ///< The Module-addressed scheduled command data.
+#endif
+                KernelCommand kernel_command;                   ///< The Kernel-addressed command data.
+                DequeueModuleCommand module_dequeue;            ///< The Module-addressed dequeue command data.
+                ModuleParameters module_parameters_header;      ///< The Module-addressed parameters message header.
+                PartialModuleParameters partial_module_parameters_header;  ///< The partial parameters message header.
+                ModuleEventLimit module_event_limit;            ///< The Module-addressed event limit data.
+                SequenceProgram sequence_program_header;        ///< The command sequence program message header.
+
+                ReceivedMessage() : repeated_module_command() {}
+        };
+
+        /// Stores the header data of the last received message. Only the member that matches the _protocol_code is
+        /// valid.
+        ReceivedMessage _received_message;
+
+        /// Stores the parameter data of the last received parameters message if the message is broadcast to multiple
+        /// modules. See the BufferModuleParameters() method for details.
+        uint8_t _buffered_parameters[kMaximumParameterSize] = {};  // NOLINT(*-avoid-c-arrays)
+
+        /// Stores the number of bytes in the _buffered_parameters array. A value of 0 indicates that the parameter data
+        /// of the last received message has to be read from the reception buffer.
+        uint8_t _buffered_parameter_size = 0;
+
+#if AXMC_TRANSMISSION_BUFFER_SIZE > 0
+        /// Buffers the encoded message frames until they are written to the communication port by the
+        /// SendBufferedData() method. Has to be initialized before the TransportLayer instance that writes to it.
+        TransmissionBuffer<AXMC_TRANSMISSION_BUFFER_SIZE> _transmission_buffer;
+#else
+        /// Stores the communication port used to determine the free transmission space for the droppable messages.
+        Stream& _communication_port;
+#endif
 
         /// Manages the bidirectional communication with the PC.
-        TransportLayer<uint16_t, kMaximumPayloadSize, kMaximumPayloadSize> _transport_layer;
+        TransportLayer<CrcType, kMaximumTransmittedPayloadSize, kMaximumReceivedPayloadSize> _transport_layer;
+
+        /// Returns the header of the input prepared data message.
+        template <typename ObjectType>
+        static ModuleDataHeader& HeaderOf(PreparedDataMessage<ObjectType>& message)
+        {
+            return message.header;
+        }
+
+        /// Returns the header of the input prepared state message.
+        static ModuleStateHeader& HeaderOf(PreparedStateMessage& message)
+        {
+            return message;
+        }
+
+        /// Returns the number of parameter bytes received with the last ModuleParameters or PartialModuleParameters
+        /// message.
+        [[nodiscard]]
+        size_t get_received_parameter_size() const
+        {
+            if (_buffered_parameter_size != 0) return _buffered_parameter_size;
+
+            // The '-1' accounts for the protocol code (first variable of each message) that precedes the message
+            // header.
+            const size_t header_size = _protocol_code == static_cast<uint8_t>(kProtocols::kPartialModuleParameters)
+                                           ? sizeof(PartialModuleParameters)
+                                           : sizeof(ModuleParameters);
+            return _transport_layer.get_bytes_in_reception_buffer() - header_size - 1;
+        }
+
+        /**
+         * @brief Extracts the parameter bytes transmitted with the last received PartialModuleParameters message into
+         * the addressed range of the destination object's bytes.
+         *
+         * @param destination The pointer to the first byte of the destination object.
+         * @param object_size The size of the destination object, in bytes.
+         *
+         * @returns true if the parameter bytes were successfully extracted into the destination object and false
+         * otherwise.
+         */
+        bool ExtractPartialModuleParameters(uint8_t* destination, const size_t object_size)
+        {
+            const PartialModuleParameters& header = _received_message.partial_module_parameters_header;
+
+            // Verifies that the addressed range is not empty, lies within the destination object, and exactly matches
+            // the number of parameter bytes received with the message. Since all checks are done before extracting the
+            // data, the destination object is never partially updated.
+            if (header.length == 0 || header.length != get_received_parameter_size() ||
+                static_cast<size_t>(header.offset) + header.length > object_size)
+            {
+                _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kParameterMismatch);
+                return false;
+            }
+
+            if (_buffered_parameter_size != 0)
+            {
+                memcpy(destination + header.offset, _buffered_parameters, header.length);
+                _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kParametersExtracted);
+                return true;
+            }
+
+            for (uint8_t i = 0; i < header.length; i++)
+            {
+                if (!_transport_layer.ReadData(destination[header.offset + i]))
+                {
+                    _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kParsingError);
+                    return false;
+                }
+            }
+
+            _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kParametersExtracted);
+            return true;
+        }
+
+        /**
+         * @brief If message batching is enabled, prepares the open batched message payload to store a message of the
+         * specified size.
+         *
+         * If the message does not fit into the open batch, sends the batch to the PC and opens a new batch. If the
+         * message is too large to be batched, sends the open batch to the PC to preserve the order of the transmitted
+         * messages.
+         *
+         * @param message_size The size of the message, in bytes, including the message header and data object.
+         *
+         * @returns true if the message has to be appended to the open batch, false if the message has to be sent as a
+         * standalone message.
+         */
+        bool ReserveBatchSpace(const size_t message_size)
+        {
+            // If batching is disabled, all messages are sent as standalone messages.
+            if (_batch_age_limit == 0) return false;
+
+            // The '+1' accounts for the batch protocol code that precedes all batched messages.
+            if (message_size + 1 > kMaximumTransmittedPayloadSize)
+            {
+                SendBatchedMessages();
+                return false;
+            }
+
+            // If the message does not fit into the open batch, sends the batch to make space for the message.
+            if (_batch_size + message_size > kMaximumTransmittedPayloadSize) SendBatchedMessages();
+
+            // If necessary, opens a new batch by writing the batch protocol code to the transmission buffer. Since the
+            // transmission buffer is always empty at this point, this operation cannot fail.
+            if (_batch_size == 0)
+            {
+                _transport_layer.WriteData(static_cast<uint8_t>(kProtocols::kBatchedMessages));
+                _batch_size  = 1;
+                _batch_timer = 0;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Sends the message written to the transmission buffer to the PC or, if the message is batched, appends
+         * it to the open batch.
+         *
+         * @param batched Determines whether the message was written to the open batched message payload.
+         * @param message_size The size of the message, in bytes, including the message header and data object.
+         *
+         * @returns true if the message is sent or batched, false otherwise.
+         */
+        bool FinalizeMessage(const bool batched, const size_t message_size)
+        {
+            if (batched)
+            {
+                _batch_size           += static_cast<uint16_t>(message_size);
+                _communication_status  = static_cast<uint8_t>(kCommunicationStatusCodes::kMessageBatched);
+
+                // If the batch has exceeded the age limit, sends it to the PC.
+                if (_batch_timer >= _batch_age_limit) return SendBatchedMessages();
+                return true;
+            }
+
+            // Otherwise, sends the message to the PC.
+            return TransmitPayload();
+        }
+
+        /**
+         * @brief Sends the payload stored in the transmission buffer to the PC.
+         *
+         * If the instance is compiled with the asynchronous transmission mode enabled, the encoded message frame is
+         * stored in the transmission ring buffer instead of being written to the communication port.
+         *
+         * @returns true if the payload is sent or buffered, false if the transmission ring buffer does not have enough
+         * space to store the message frame.
+         */
+        bool TransmitPayload()
+        {
+#if AXMC_TRANSMISSION_BUFFER_SIZE > 0
+            // Frames are buffered atomically. If the frame does not fit into the ring buffer, it is discarded entirely.
+            _transmission_buffer.BeginFrame();
+            _transport_layer.SendData();
+            if (!_transmission_buffer.EndFrame())
+            {
+                _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kBufferOverflow);
+                return false;
+            }
+#else
+            _transport_layer.SendData();
+#endif
+            _communication_status = static_cast<uint8_t>(kCommunicationStatusCodes::kMessageSent);
+            return true;
+        }
 };
 
+static_assert(
+    sizeof(Communication) <= AXMC_COMMUNICATION_RAM_BUDGET,
+    "The Communication class instance exceeds the RAM budget of the target board. Reduce the "
+    "AXMC_TRANSMISSION_BUFFER_SIZE or increase the AXMC_COMMUNICATION_RAM_BUDGET build flag value."
+);
+
 #endif  //AXMC_COMMUNICATION_H
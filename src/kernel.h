@@ -25,6 +25,259 @@
 
 using namespace axmc_shared_assets;
 
+/**
+ * @def AXMC_ENABLE_DEADLINE_SCHEDULER
+ * @brief Determines whether the Kernel class uses the deadline scheduler to run the commands of the managed modules.
+ *
+ * When set to a non-zero value (for example, via the '-D AXMC_ENABLE_DEADLINE_SCHEDULER=1' build flag), the Kernel
+ * tracks the modules that are waiting for recurrent command or non-blocking stage delays to expire in a min-heap
+ * ordered by the delay expiration time and does not poll these modules until their delays expire. By default, the
+ * deadline scheduler is disabled and the Kernel polls every managed module during each runtime cycle.
+ */
+#ifndef AXMC_ENABLE_DEADLINE_SCHEDULER
+#define AXMC_ENABLE_DEADLINE_SCHEDULER 0
+#endif
+
+/**
+ * @def AXMC_ENABLE_PERFORMANCE_TELEMETRY
+ * @brief Determines whether the Kernel class measures the duration of its runtime cycles and managed module commands.
+ *
+ * When set to a non-zero value (for example, via the '-D AXMC_ENABLE_PERFORMANCE_TELEMETRY=1' build flag), the Kernel
+ * records the duration statistics of each runtime cycle, data reception loop, and module command execution, and sends
+ * them to the PC in response to the kReportPerformance Kernel command. By default, the telemetry is disabled and the
+ * Kernel does not execute any instrumentation code.
+ */
+#ifndef AXMC_ENABLE_PERFORMANCE_TELEMETRY
+#define AXMC_ENABLE_PERFORMANCE_TELEMETRY 0
+#endif
+
+/**
+ * @def AXMC_RECEPTION_MESSAGE_BUDGET
+ * @brief Determines the maximum number of PC-sent messages the Kernel class processes during a single runtime cycle.
+ *
+ * When set to a non-zero value (for example, via the '-D AXMC_RECEPTION_MESSAGE_BUDGET=8' build flag), the Kernel
+ * stops receiving data once it processes the specified number of messages and runs the managed module commands before
+ * processing the remaining messages during the next runtime cycle. By default, the Kernel processes all available
+ * messages during each runtime cycle.
+ */
+#ifndef AXMC_RECEPTION_MESSAGE_BUDGET
+#define AXMC_RECEPTION_MESSAGE_BUDGET 0
+#endif
+
+/**
+ * @def AXMC_RECEPTION_TIME_BUDGET
+ * @brief Determines the maximum duration, in microseconds, of the data reception loop of a single Kernel runtime cycle.
+ *
+ * When set to a non-zero value (for example, via the '-D AXMC_RECEPTION_TIME_BUDGET=500' build flag), the Kernel stops
+ * receiving data once the reception loop runs for the specified duration and runs the managed module commands before
+ * processing the remaining messages during the next runtime cycle. The budget is checked after processing each message,
+ * so the message being processed when the budget expires is always completed. By default, the reception loop duration
+ * is not limited.
+ */
+#ifndef AXMC_RECEPTION_TIME_BUDGET
+#define AXMC_RECEPTION_TIME_BUDGET 0
+#endif
+
+/**
+ * @def AXMC_ENABLE_PRIORITY_SCHEDULING
+ * @brief Determines whether the Kernel class uses the execution priority class of each managed module to schedule the
+ * module's commands.
+ *
+ * When set to a non-zero value (for example, via the '-D AXMC_ENABLE_PRIORITY_SCHEDULING=1' build flag), the Kernel
+ * runs high-priority modules at the beginning of each runtime cycle and again after each lower-priority module executes
+ * a command, normal-priority modules once per cycle, and low-priority modules in a round-robin order until the
+ * low-priority time budget of the cycle is exhausted. By default, the Kernel runs every managed module once per cycle
+ * in the order of the array of managed modules, regardless of module priorities.
+ */
+#ifndef AXMC_ENABLE_PRIORITY_SCHEDULING
+#define AXMC_ENABLE_PRIORITY_SCHEDULING 0
+#endif
+
+/**
+ * @def AXMC_LOW_PRIORITY_TIME_BUDGET
+ * @brief Determines the duration, in microseconds, the Kernel compiled with the priority scheduler spends running
+ * low-priority modules during each runtime cycle.
+ *
+ * The budget is checked after running each low-priority module, and at least one low-priority module is run during
+ * each cycle, so low-priority modules are never starved.
+ */
+#ifndef AXMC_LOW_PRIORITY_TIME_BUDGET
+#define AXMC_LOW_PRIORITY_TIME_BUDGET 1000
+#endif
+
+/**
+ * @def AXMC_RECEPTION_CODE_BATCH_SIZE
+ * @brief Determines the maximum number of reception codes the Kernel class sends to the PC as part of a single
+ * kReceptionCodes service message.
+ *
+ * When set to a non-zero value (for example, via the '-D AXMC_RECEPTION_CODE_BATCH_SIZE=32' build flag), the Kernel
+ * buffers the reception codes of the acknowledged PC-sent messages and sends them as a single message once the buffer
+ * fills up or the reception code window expires. By default, the Kernel sends each reception code as a separate
+ * kReceptionCode service message as soon as the acknowledged message is received.
+ */
+#ifndef AXMC_RECEPTION_CODE_BATCH_SIZE
+#define AXMC_RECEPTION_CODE_BATCH_SIZE 0
+#endif
+
+/**
+ * @def AXMC_RECEPTION_CODE_WINDOW
+ * @brief Determines the maximum duration, in microseconds, the Kernel class buffers the reception codes before sending
+ * them to the PC.
+ *
+ * The window is checked at the end of each runtime cycle. If set to 0 (default), the Kernel sends the buffered
+ * reception codes at the end of each runtime cycle during which they were received. Larger windows bundle the codes
+ * received over multiple cycles into fewer messages at the cost of delaying the acknowledgments.
+ */
+#ifndef AXMC_RECEPTION_CODE_WINDOW
+#define AXMC_RECEPTION_CODE_WINDOW 0
+#endif
+
+/**
+ * @def AXMC_DROP_REPORT_INTERVAL
+ * @brief Determines the interval, in microseconds, at which the Kernel class reports the droppable messages dropped by
+ * the managed modules to the PC.
+ *
+ * Once per interval, the Kernel sends a kMessagesDropped message for each managed module that dropped messages since
+ * the previous report and resets the module's dropped message counter. By default, the interval is 1 second. Setting
+ * this value to 0 (via the '-D AXMC_DROP_REPORT_INTERVAL=0' build flag) disables the reports.
+ */
+#ifndef AXMC_DROP_REPORT_INTERVAL
+#define AXMC_DROP_REPORT_INTERVAL 1000000
+#endif
+
+/// Determines whether the Kernel class limits the data reception loop of each runtime cycle.
+#define AXMC_ENABLE_RECEPTION_BUDGET (AXMC_RECEPTION_MESSAGE_BUDGET > 0 || AXMC_RECEPTION_TIME_BUDGET > 0)
+
+/**
+ * @brief Calls the custom API methods of the hardware module instances managed by the Kernel class via the virtual
+ * Module interface.
+ *
+ * This dispatcher supports managing any set of Module-derived instances whose concrete types are not known to the
+ * Kernel and is used by the default Kernel class.
+ */
+struct VirtualModuleDispatcher
+{
+    /// Calls the input callback with each managed module instance and its index in the array of managed modules.
+    template <typename Callback>
+    static void ForEachModule(Module** modules, const size_t module_count, Callback&& callback)
+    {
+        for (size_t i = 0; i < module_count; i++) callback(*modules[i], i);
+    }
+
+    /// Calls the input callback with the managed module instance stored under the specified index and returns the
+    /// callback's result.
+    template <typename Callback>
+    static bool VisitModule(Module** modules, const size_t index, Callback&& callback)
+    {
+        return callback(*modules[index]);
+    }
+
+    /// Calls the SetupModule() virtual method of the input module instance.
+    static bool SetupModule(Module& module)
+    {
+        return module.SetupModule();
+    }
+
+    /// Calls the SetCustomParameters() virtual method of the input module instance.
+    static bool SetCustomParameters(Module& module)
+    {
+        return module.SetCustomParameters();
+    }
+
+    /// Calls the RunActiveCommand() virtual method of the input module instance.
+    static bool RunActiveCommand(Module& module)
+    {
+        return module.RunActiveCommand();
+    }
+};
+
+/**
+ * @brief Calls the custom API methods of the hardware module instances managed by the StaticKernel class without
+ * virtual dispatch.
+ *
+ * Since the concrete type of each managed module is known at compile time, this dispatcher unrolls all loops over the
+ * managed modules and calls each module's custom API methods directly, allowing the compiler to inline them into the
+ * Kernel runtime cycle.
+ *
+ * @tparam Modules The concrete (most-derived) types of the managed hardware module instances, in the order in which
+ * they are stored in the array of managed modules.
+ */
+template <typename... Modules>
+class StaticModuleDispatcher
+{
+    static_assert(
+        sizeof...(Modules) > 0,
+        "At least one valid Module-derived class instance must be provided during StaticKernel class initialization."
+    );
+
+    public:
+        /// Calls the input callback with each managed module instance and its index in the array of managed modules.
+        template <typename Callback>
+        static void ForEachModule(Module** modules, size_t, Callback&& callback)
+        {
+            ForEach<0, Modules...>(modules, callback);
+        }
+
+        /// Calls the input callback with the managed module instance stored under the specified index and returns the
+        /// callback's result.
+        template <typename Callback>
+        static bool VisitModule(Module** modules, const size_t index, Callback&& callback)
+        {
+            return Visit<0, Modules...>(modules, index, callback);
+        }
+
+        /// Calls the SetupModule() method of the input module instance without virtual dispatch.
+        template <typename ModuleType>
+        static bool SetupModule(ModuleType& module)
+        {
+            return module.ModuleType::SetupModule();
+        }
+
+        /// Calls the SetCustomParameters() method of the input module instance without virtual dispatch.
+        template <typename ModuleType>
+        static bool SetCustomParameters(ModuleType& module)
+        {
+            return module.ModuleType::SetCustomParameters();
+        }
+
+        /// Calls the RunActiveCommand() method of the input module instance without virtual dispatch.
+        template <typename ModuleType>
+        static bool RunActiveCommand(ModuleType& module)
+        {
+            return module.ModuleType::RunActiveCommand();
+        }
+
+    protected:
+        /// Stores the pointers to the managed module instances.
+        Module* _module_array[sizeof...(Modules)];  // NOLINT(*-avoid-c-arrays)
+
+        /// Stores the pointers to the input module instances.
+        explicit StaticModuleDispatcher(Modules&... modules) : _module_array {&modules...}
+        {}
+
+    private:
+        /// Calls the input callback with the module stored under kIndex and, recursively, all following modules.
+        template <const size_t kIndex, typename ModuleType, typename... RemainingModules, typename Callback>
+        static void ForEach(Module** modules, Callback& callback)
+        {
+            callback(static_cast<ModuleType&>(*modules[kIndex]), kIndex);
+            if constexpr (sizeof...(RemainingModules) > 0) ForEach<kIndex + 1, RemainingModules...>(modules, callback);
+        }
+
+        /// Resolves the concrete type of the module stored under the specified index and calls the input callback with
+        /// that module.
+        template <const size_t kIndex, typename ModuleType, typename... RemainingModules, typename Callback>
+        static bool Visit(Module** modules, const size_t index, Callback& callback)
+        {
+            // The index of the last module is not checked, as the Kernel only visits the indices of managed modules.
+            if constexpr (sizeof...(RemainingModules) > 0)
+            {
+                if (index != kIndex) return Visit<kIndex + 1, RemainingModules...>(modules, index, callback);
+            }
+            return callback(static_cast<ModuleType&>(*modules[kIndex]));
+        }
+};
+
 /**
  * @brief Manages the runtime of one or more custom hardware module instances.
  *
@@ -34,10 +287,14 @@ using namespace axmc_shared_assets;
  * @warning After initialization, call the instance's Setup() method in the main setup() function and the RuntimeCycle()
  * method in the main loop() function of the main.cpp / main.ino file.
  *
- * @note During initialization, this class should be provided with an array of hardware module instances
- * that inherit from the Module class.
+ * @note Do not use this class directly. Instead, use the Kernel class, which manages an array of hardware module
+ * instances that inherit from the Module class, or the StaticKernel class, which manages a set of module instances
+ * whose types are known at compile time.
+ *
+ * @tparam ModuleDispatcher The dispatcher used to call the custom API methods of the managed module instances.
  */
-class Kernel
+template <typename ModuleDispatcher>
+class BasicKernel
 {
     public:
         /// Defines the codes used by the Kernel class to communicate its runtime state to the PC.
@@ -54,6 +311,21 @@ class Kernel
             kCommandNotRecognized   = 8,   ///< Received an unsupported (unknown) Kernel command.
             kTargetModuleNotFound   = 9,   ///< Unable to find the module with the requested combined type and ID code.
             kKeepAliveTimeout       = 10,  ///< The Kernel did not receive a keepalive message within the expected time.
+            kDuplicateModuleTypeID  = 11,  ///< Multiple managed modules use the same combined type and ID code.
+            kCyclePerformance       = 12,  ///< Reports the runtime cycle duration statistics.
+            kReceptionPerformance   = 13,  ///< Reports the data reception loop duration statistics.
+            kCycleHistogram         = 14,  ///< Reports the histogram of runtime cycle durations.
+            kModulePerformance      = 15,  ///< Reports the command execution duration statistics of a managed module.
+            kClockSynchronization   = 16,  ///< Reports the controller time at which the clock sync command arrived.
+            kReceptionBudgetReached = 17,  ///< Reports the number of cycles that exhausted the data reception budget.
+            kReservedModuleID       = 18,  ///< A managed module uses the ID reserved for the broadcast commands.
+            kInvalidActivationTime  = 19,  ///< The scheduled command's activation time is too far in the future.
+            kSequenceLoaded         = 20,  ///< Received and stored the command sequence program.
+            kSequenceError          = 21,  ///< Unable to load, start, or continue the command sequence program.
+            kSequenceCompleted      = 22,  ///< The command sequence program completed all requested runs.
+            kMessagesDropped        = 23,  ///< Reports the number of droppable messages dropped by a managed module.
+            kEventLimitSet          = 24,  ///< Received and applied the event limit addressed to the module instance.
+            kEventLimitError        = 25,  ///< Unable to apply the received event limit to the module instance.
         };
 
         /// Defines the codes for the supported Kernel commands.
@@ -65,6 +337,10 @@ class Kernel
             kIdentifyController = 3,  ///< Sends the ID of the controller to the PC.
             kIdentifyModules    = 4,  ///< Sequentially sends each managed module's combined Type+ID code to the PC.
             kKeepAlive          = 5,  ///< Resets the keepalive watchdog timer, starting a new keepalive cycle.
+            kReportPerformance  = 6,  ///< Sends the collected runtime performance statistics to the PC.
+            kSynchronizeClock   = 7,  ///< Sends the controller time to the PC to estimate the controller clock offset.
+            kStartSequence      = 8,  ///< Starts running the command sequence program from its first step.
+            kStopSequence       = 9,  ///< Stops running the command sequence program.
         };
 
         /// Returns the currently active Kernel command code.
@@ -80,6 +356,16 @@ class Kernel
             _kernel_command = command;
         }
 
+#if AXMC_ENABLE_RECEPTION_BUDGET
+        /// Returns the number of runtime cycles whose data reception loop was ended early due to exhausting the
+        /// reception budget while more received data was waiting to be processed.
+        [[nodiscard]]
+        uint32_t get_reception_budget_overruns() const
+        {
+            return _reception_budget_overruns;
+        }
+#endif
+
         /**
          * @brief Initializes the necessary assets used to manage the runtime of the input hardware module instances.
          *
@@ -96,7 +382,7 @@ class Kernel
          * keepalive mechanism.
          */
         template <const size_t kModuleNumber>
-        Kernel(
+        BasicKernel(
             const uint8_t controller_id,
             Communication& communication,
             Module* (&module_array)[kModuleNumber],
@@ -104,6 +390,14 @@ class Kernel
         ) :
             _modules(module_array),
             _module_count(kModuleNumber),
+            _lookup_table(ReserveStorage<ModuleLookupEntry, kModuleNumber>()),
+#if AXMC_ENABLE_DEADLINE_SCHEDULER
+            _schedule(ReserveStorage<ScheduleEntry, kModuleNumber>()),
+            _schedule_states(ReserveStorage<ModuleScheduleState, kModuleNumber>()),
+#endif
+#if AXMC_ENABLE_PERFORMANCE_TELEMETRY
+            _module_timings(ReserveStorage<TimingStatistics, kModuleNumber>()),
+#endif
             _controller_id(controller_id),
             _keepalive_interval(keepalive_interval * kKeepaliveIntervalMultiplier),
             _communication(communication)
@@ -116,13 +410,44 @@ class Kernel
             );
         }
 
+        /**
+         * @brief Initializes the necessary assets used to manage the runtime of the input hardware module instances
+         * that send their bulk-data messages via a dedicated Communication instance.
+         *
+         * The Kernel receives the PC-sent messages and sends its own messages via the control Communication instance.
+         * The managed modules send their messages via the control or the bulk-data Communication instance, depending
+         * on the message class. See the Module class SetMessageChannels() method for details.
+         *
+         * @param controller_id The unique identifier of the microcontroller that uses this Kernel instance.
+         * @param communication The control Communication instance used to bidirectionally communicate with the PC
+         * during runtime.
+         * @param data_communication The Communication instance used by the managed modules to send the bulk-data
+         * messages to the PC. Must use a different communication port than the control Communication instance.
+         * @param module_array The array of pointers to custom hardware module instances.
+         * @param keepalive_interval The interval, in milliseconds, used to derive the keepalive timeout. Setting this
+         * parameter to 0 disables the keepalive mechanism.
+         */
+        template <const size_t kModuleNumber>
+        BasicKernel(
+            const uint8_t controller_id,
+            Communication& communication,
+            Communication& data_communication,
+            Module* (&module_array)[kModuleNumber],
+            const uint32_t keepalive_interval = 0
+        ) :
+            BasicKernel(controller_id, communication, module_array, keepalive_interval)
+        {
+            _data_communication = &data_communication;
+        }
+
         /**
          * @brief Configures the hardware and software assets used by the Kernel and all managed hardware modules.
          *
          * @warning This method deactivates the built-in LED of the controller board. Seeing the LED constantly ON
          * (HIGH) after this method's runtime means the controller experienced a communication error when it tried
          * sending data to the PC. Seeing the LED blink on and off at ~2-second intervals indicates that the Kernel
-         * failed the setup sequence.
+         * failed the setup sequence, which happens if any managed module fails its setup or if multiple managed modules
+         * use the same combined type and ID code.
          *
          * @note This method has to be called as part of the main setup() function.
          */
@@ -136,11 +461,47 @@ class Kernel
             // controller if any managed module reports a failure to setup.
             _setup_complete = false;
 
-            // Loops over each module and calls its SetupModule() virtual method. Note, expects that setup methods
-            // generally cannot fail, but supports non-success return codes.
+            // Releases the command execution hold of the module whose blocking command was interrupted by the reset.
+            _blocking_module = -1;
+
+            // Builds the lookup table used to resolve the modules addressed by the PC-sent messages. If multiple
+            // modules use the same combined type and ID code or a module uses the reserved broadcast ID, they cannot be
+            // addressed unambiguously. In this case, sends an error message to the PC and returns without completing
+            // the setup.
+            if (!BuildLookupTable()) return;
+
+#if AXMC_ENABLE_DEADLINE_SCHEDULER
+            // Discards the scheduling state accumulated during the previous runtime and marks all modules as ready to
+            // be polled for commands.
+            ResetSchedule();
+#endif
+
+#if AXMC_SEQUENCE_STEP_COUNT > 0
+            // Stops the running command sequence program, if any. The loaded program is kept and can be restarted.
+            StopSequence();
+#endif
+
+#if AXMC_EVENT_LIMIT_COUNT > 0
+            // Removes the event limits configured by the PC during the previous runtime.
+            for (size_t i = 0; i < _module_count; i++) _modules[i]->ResetEventLimits();
+#endif
+
+            // Routes the bulk-data messages of all managed modules to the bulk-data Communication instance, if the
+            // Kernel uses one. This is done before the module setup so that the modules can send data during setup.
+            if (_data_communication != nullptr)
+            {
+                for (size_t i = 0; i < _module_count; i++) _modules[i]->SetDataCommunication(*_data_communication);
+            }
+
+            // Loops over each module and calls its SetupModule() method. Note, expects that setup methods generally
+            // cannot fail, but supports non-success return codes.
             for (size_t i = 0; i < _module_count; i++)
             {
-                if (!_modules[i]->SetupModule())
+                if (!ModuleDispatcher::VisitModule(
+                        _modules,
+                        i,
+                        [](auto& module) { return ModuleDispatcher::SetupModule(module); }
+                    ))
                 {
                     // If the setup fails, sends an error message to notify the PC of the setup failure.
                     const uint8_t error_object[2] = {
@@ -180,6 +541,11 @@ class Kernel
          * Once all data is received, the method loops over managed modules and executes one command execution stage
          * for each module.
          *
+         * At the end of each cycle, if the shared Communication instance is configured to batch outgoing messages, the
+         * method sends the open batch to the PC if it has exceeded the configured age limit. If the Communication
+         * instance uses the asynchronous transmission mode, the method then writes the buffered message frames to the
+         * communication port.
+         *
          * @note This method has to be repeatedly called as part of the main loop() function.
          */
         void RuntimeCycle()
@@ -200,6 +566,10 @@ class Kernel
             // LED to visually communicate setup error to the user.
             if (!_setup_complete)
             {
+                // If the asynchronous transmission mode is enabled, ensures that the setup error message reaches the
+                // PC.
+                _communication.SendBufferedData();
+
                 digitalWriteFast(LED_BUILTIN, HIGH);
                 delay(kSetupErrorBlinkDelay);
                 digitalWriteFast(LED_BUILTIN, LOW);
@@ -207,13 +577,33 @@ class Kernel
                 return;  // Ends cycle. A firmware reset is needed to get out of this loop.
             }
 
+#if AXMC_ENABLE_PERFORMANCE_TELEMETRY
+            // Starts timing the runtime cycle and the data reception loop.
+            const uint32_t cycle_start = micros();
+#endif
+
+#if AXMC_ENABLE_MESSAGE_TIMESTAMPS
+            // Ensures that the 64-bit message timestamps account for every microsecond timer overflow.
+            static_cast<void>(_communication.GetTimestamp());
+            if (_data_communication != nullptr) static_cast<void>(_data_communication->GetTimestamp());
+#endif
+
+#if AXMC_ENABLE_RECEPTION_BUDGET
+            // Tracks the number of processed messages and the duration of the reception loop to end the loop early if
+            // it exhausts the reception budget.
+            size_t processed_messages      = 0;
+            const uint32_t reception_start = micros();
+#endif
+
             // Continuously parses the data received from the PC until all data is processed.
             _kernel_command = static_cast<uint8_t>(kKernelCommands::kReceiveData);
             while (true)
             {
                 const uint8_t protocol = ReceiveData();
                 bool break_loop = false;  // A flag used to break the while loop once all available data is received.
+#if AXMC_EVENT_LIMIT_COUNT > 0
                 int16_t target_module;    // Stores the index of the module targeted by Module-addressed command.
+#endif
                 uint8_t return_code;      // Stores the return code of the received message.
 
                 // Uses the message protocol of the returned message to execute appropriate logic to handle the message.
@@ -223,39 +613,49 @@ class Kernel
                     // receive or due to a reception pipeline error. In either case, this ends the reception loop.
                     case kProtocols::kUndefined: break_loop = true; break;
 
+                    // Partial parameter messages are addressed through the same header fields as the full parameter
+                    // messages. The Module resolves both message types via the same ExtractParameters() method.
                     case kProtocols::kModuleParameters:
+                    case kProtocols::kPartialModuleParameters:
                         return_code = _communication.get_module_parameters_header().return_code;
                         if (return_code) SendReceptionCode(return_code);
+                        ApplyModuleParameters();
+                        break;
+
+#if AXMC_SEQUENCE_STEP_COUNT > 0
+                    case kProtocols::kSequenceProgram: LoadSequence(); break;
+#endif
+
+#if AXMC_EVENT_LIMIT_COUNT > 0
+                    case kProtocols::kModuleEventLimit:
+                        return_code = _communication.get_module_event_limit().return_code;
+                        if (return_code) SendReceptionCode(return_code);
 
-                        // For module-addressed commands, attempts to resolve (discover) the addressed module. If this
-                        // method succeeds, it returns an index (>=0) of the target module class inside the _modules
-                        // array
                         target_module = ResolveTargetModule(
-                            _communication.get_module_parameters_header().module_type,
-                            _communication.get_module_parameters_header().module_id
+                            _communication.get_module_event_limit().module_type,
+                            _communication.get_module_event_limit().module_id
                         );
-
-                        // Aborts early if the target module is not found, as indicated by the returned code being
-                        // a negative number (-1).
                         if (target_module < 0) break;
 
-                        // Calls the Module API method that processes the parameter object included with the message
-                        if (!_modules[static_cast<size_t>(target_module)]->SetCustomParameters())
+                        // Applies the event limit and notifies the PC whether the limit was applied. Includes the
+                        // addressed module and event codes with the error message.
+                        if (_modules[static_cast<size_t>(target_module)]->ConfigureEventLimit(
+                                _communication.get_module_event_limit()
+                            ))
                         {
-                            // If the module fails to process the parameters, as indicated by the API method returning
-                            // 'false', sends an error message to the PC to communicate the error.
-                            const uint8_t error_object[2] = {
-                                _modules[static_cast<size_t>(target_module)]->get_module_type(),
-                                _modules[static_cast<size_t>(target_module)]->get_module_id(),
-                            };
-                            SendData(static_cast<uint8_t>(kKernelStatusCodes::kModuleParametersError), error_object);
+                            SendData(static_cast<uint8_t>(kKernelStatusCodes::kEventLimitSet));
                         }
                         else
                         {
-                            // If the parameters were set correctly, notifies the PC.
-                            SendData(static_cast<uint8_t>(kKernelStatusCodes::kModuleParametersSet));
+                            const uint8_t error_object[3] = {
+                                _communication.get_module_event_limit().module_type,
+                                _communication.get_module_event_limit().module_id,
+                                _communication.get_module_event_limit().event,
+                            };
+                            SendData(static_cast<uint8_t>(kKernelStatusCodes::kEventLimitError), error_object);
                         }
                         break;
+#endif
 
                     case kProtocols::kKernelCommand:
                         return_code = _communication.get_kernel_command().return_code;
@@ -269,55 +669,67 @@ class Kernel
                     case kProtocols::kDequeueModuleCommand:
                         return_code = _communication.get_module_dequeue().return_code;
                         if (return_code) SendReceptionCode(return_code);
-                        target_module = ResolveTargetModule(
-                            _communication.get_module_dequeue().module_type,
-                            _communication.get_module_dequeue().module_id
-                        );
 
-                        // Aborts early if the target module is not found, as indicated by the returned code being
-                        // a negative number (-1).
-                        if (target_module < 0) break;
-
-                        // Resets the queue of the target module. Note, this does not abort already running commands:
+                        // Resets the queue of each target module. Note, this does not abort already running commands:
                         // they are allowed to finish gracefully.
-                        _modules[static_cast<size_t>(target_module)]->ResetCommandQueue();
+                        ForEachTargetModule(
+                            _communication.get_module_dequeue().module_type,
+                            _communication.get_module_dequeue().module_id,
+                            [this](const size_t index)
+                            {
+                                _modules[index]->ResetCommandQueue();
+#if AXMC_ENABLE_DEADLINE_SCHEDULER
+                                WakeModule(index);
+#endif
+                            }
+                        );
                         break;
 
                     case kProtocols::kOneOffModuleCommand:
                         return_code = _communication.get_one_off_module_command().return_code;
                         if (return_code) SendReceptionCode(return_code);
 
-                        target_module = ResolveTargetModule(
-                            _communication.get_one_off_module_command().module_type,
-                            _communication.get_one_off_module_command().module_id
-                        );
-
-                        if (target_module < 0) break;
-
                         // Uses an overloaded QueueCommand method that always sets the input command as non-recurrent.
-                        _modules[static_cast<size_t>(target_module)]->QueueCommand(
-                            _communication.get_one_off_module_command().command,
-                            _communication.get_one_off_module_command().noblock
+                        ForEachTargetModule(
+                            _communication.get_one_off_module_command().module_type,
+                            _communication.get_one_off_module_command().module_id,
+                            [this](const size_t index)
+                            {
+                                _modules[index]->QueueCommand(
+                                    _communication.get_one_off_module_command().command,
+                                    _communication.get_one_off_module_command().noblock
+                                );
+#if AXMC_ENABLE_DEADLINE_SCHEDULER
+                                WakeModule(index);
+#endif
+                            }
                         );
                         break;
 
+#if AXMC_ENABLE_MESSAGE_TIMESTAMPS
+                    case kProtocols::kScheduledModuleCommand: ScheduleModuleCommand(); break;
+#endif
+
                     case kProtocols::kRepeatedModuleCommand:
                         return_code = _communication.get_repeated_module_command().return_code;
                         if (return_code) SendReceptionCode(return_code);
 
-                        target_module = ResolveTargetModule(
-                            _communication.get_repeated_module_command().module_type,
-                            _communication.get_repeated_module_command().module_id
-                        );
-
-                        if (target_module < 0) break;
-
                         // Uses the non-overloaded QueueCommand method that always sets the input command to execute
                         // recurrently.
-                        _modules[static_cast<size_t>(target_module)]->QueueCommand(
-                            _communication.get_repeated_module_command().command,
-                            _communication.get_repeated_module_command().noblock,
-                            _communication.get_repeated_module_command().cycle_delay
+                        ForEachTargetModule(
+                            _communication.get_repeated_module_command().module_type,
+                            _communication.get_repeated_module_command().module_id,
+                            [this](const size_t index)
+                            {
+                                _modules[index]->QueueCommand(
+                                    _communication.get_repeated_module_command().command,
+                                    _communication.get_repeated_module_command().noblock,
+                                    _communication.get_repeated_module_command().cycle_delay
+                                );
+#if AXMC_ENABLE_DEADLINE_SCHEDULER
+                                WakeModule(index);
+#endif
+                            }
                         );
                         break;
 
@@ -333,8 +745,28 @@ class Kernel
 
                 // If necessary, breaks the reception loop.
                 if (break_loop) break;
+
+#if AXMC_ENABLE_RECEPTION_BUDGET
+                // If the loop exhausted the reception budget, defers processing the remaining messages to the next
+                // runtime cycle to run the managed module commands. Only counts the overrun if the PC has sent more
+                // data, as otherwise the loop would have ended regardless of the budget.
+                if (IsReceptionBudgetExhausted(++processed_messages, reception_start))
+                {
+                    if (_communication.is_data_available()) _reception_budget_overruns++;
+                    break;
+                }
+#endif
             }
 
+#if AXMC_ENABLE_PERFORMANCE_TELEMETRY
+            RecordDuration(_reception_timing, micros() - cycle_start);
+#endif
+
+#if AXMC_SEQUENCE_STEP_COUNT > 0
+            // Queues the module commands of the command sequence program steps that are due during this cycle.
+            RunSequence();
+#endif
+
             // Once the loop above escapes due to running out of data to receive or a reception error, triggers a method
             // that sequentially executes Module commands in the blocking or non-blocking manner.
             RunModuleCommands();
@@ -351,12 +783,50 @@ class Kernel
                 // and hardware states.
                 Setup();
             }
+
+#if AXMC_RECEPTION_CODE_BATCH_SIZE > 0
+            // Sends the buffered reception codes to the PC once the reception code window expires.
+            ResolveReceptionCodes();
+#endif
+
+#if AXMC_DROP_REPORT_INTERVAL > 0
+            // Reports the droppable messages dropped by the managed modules since the previous report.
+            if (_since_drop_report >= AXMC_DROP_REPORT_INTERVAL) ReportDroppedMessages();
+#endif
+
+            // If message batching is enabled, sends the batched messages accumulated during this and previous cycles
+            // once the batch exceeds the configured age limit.
+            _communication.ResolveBatchedMessages();
+
+            // If the asynchronous transmission mode is enabled, writes as many buffered message frames to the
+            // communication port as it can accept without blocking.
+            _communication.SendBufferedData();
+
+            // Resolves the batched and buffered messages of the bulk-data channel, if the Kernel uses one.
+            if (_data_communication != nullptr)
+            {
+                _data_communication->ResolveBatchedMessages();
+                _data_communication->SendBufferedData();
+            }
+
+#if AXMC_ENABLE_PERFORMANCE_TELEMETRY
+            // Records the duration of the runtime cycle and adds it to the cycle duration histogram.
+            const uint32_t cycle_duration = micros() - cycle_start;
+            RecordDuration(_cycle_timing, cycle_duration);
+            _cycle_histogram[GetHistogramBucket(cycle_duration)]++;
+#endif
         }
 
     private:
         /// The delay, in milliseconds, between consecutive built-in LED toggles when signaling a setup error.
         static constexpr uint32_t kSetupErrorBlinkDelay = 2000;
 
+#if AXMC_ENABLE_MESSAGE_TIMESTAMPS
+        /// The maximum delay, in microseconds, between receiving a scheduled module command and its activation time.
+        /// Longer delays cannot be resolved unambiguously by the 32-bit microsecond timer used by the modules.
+        static constexpr uint64_t kMaximumActivationDelay = 0x7FFFFFFF;
+#endif
+
         /// The multiplier applied to the requested keepalive interval to tolerate brief communication lapses.
         static constexpr uint32_t kKeepaliveIntervalMultiplier = 2;
 
@@ -369,6 +839,153 @@ class Kernel
         /// Stores the size of the _modules array.
         const size_t _module_count;
 
+        /// Stores the combined type and ID code of a managed module together with the module's index in the _modules
+        /// array.
+        struct ModuleLookupEntry
+        {
+                uint16_t type_id = 0;  ///< The combined type and ID code of the module.
+                uint16_t index   = 0;  ///< The index of the module in the _modules array.
+        };
+
+        /// Stores the lookup table used to resolve the modules addressed by the PC-sent messages. The table is sorted
+        /// by the combined type and ID code of each module during Setup() to support binary search.
+        ModuleLookupEntry* _lookup_table;
+
+#if AXMC_ENABLE_DEADLINE_SCHEDULER
+        /// Indicates that the module is not stored in the deadline scheduler's heap.
+        static constexpr uint16_t kNotScheduled = 0xFFFF;
+
+        /// Stores the time at which the delay awaited by a managed module expires together with the module's index in
+        /// the _modules array.
+        struct ScheduleEntry
+        {
+                uint32_t wake_time    = 0;  ///< The time, in microseconds, at which the module's delay expires.
+                uint16_t module_index = 0;  ///< The index of the module in the _modules array.
+        };
+
+        /// Stores the scheduling state of a managed module.
+        struct ModuleScheduleState
+        {
+                uint16_t heap_position = kNotScheduled;  ///< The position of the module's entry in the schedule heap.
+                bool ready             = true;           ///< Determines whether the module is polled for commands.
+        };
+
+        /// Stores the min-heap of modules waiting for their delays to expire, ordered by the delay expiration time.
+        ScheduleEntry* _schedule;
+
+        /// Stores the scheduling state of each managed module, indexed in the same order as the _modules array.
+        ModuleScheduleState* _schedule_states;
+
+        /// Tracks the number of modules stored in the schedule heap.
+        size_t _schedule_size = 0;
+#endif
+
+#if AXMC_ENABLE_PERFORMANCE_TELEMETRY
+        /// The number of buckets in the runtime cycle duration histogram. Bucket 0 counts the cycles that took less
+        /// than 1 microsecond, each following bucket N counts the cycles that took between 2^(N-1) and 2^N
+        /// microseconds, and the last bucket counts all cycles that took longer than 2^(N-1) microseconds.
+        static constexpr size_t kHistogramBucketCount = 16;
+
+        /// Stores the duration statistics of a repeatedly measured runtime operation.
+        struct TimingStatistics
+        {
+                uint32_t count   = 0;           ///< The number of measured operation runtimes.
+                uint32_t minimum = UINT32_MAX;  ///< The shortest measured duration, in microseconds.
+                uint32_t maximum = 0;           ///< The longest measured duration, in microseconds.
+                uint64_t total   = 0;           ///< The sum of all measured durations, in microseconds.
+        };
+
+        /// Stores the runtime cycle duration statistics.
+        TimingStatistics _cycle_timing;
+
+        /// Stores the data reception loop duration statistics.
+        TimingStatistics _reception_timing;
+
+        /// Stores the histogram of runtime cycle durations.
+        uint32_t _cycle_histogram[kHistogramBucketCount] = {};  // NOLINT(*-avoid-c-arrays)
+
+        /// Stores the command execution duration statistics of each managed module, indexed in the same order as the
+        /// _modules array.
+        TimingStatistics* _module_timings;
+#endif
+
+#if AXMC_RECEPTION_CODE_BATCH_SIZE > 0
+        static_assert(
+            AXMC_RECEPTION_CODE_BATCH_SIZE <= Communication::get_maximum_transmitted_payload_size() - 2,
+            "The AXMC_RECEPTION_CODE_BATCH_SIZE has to leave space for the protocol code and the reception code count "
+            "in the transmitted payload, which is limited by the serial buffer size of the microcontroller."
+        );
+
+        /// Stores the reception codes waiting to be sent to the PC.
+        uint8_t _reception_codes[AXMC_RECEPTION_CODE_BATCH_SIZE] = {};  // NOLINT(*-avoid-c-arrays)
+
+        /// Tracks the number of buffered reception codes.
+        uint8_t _reception_code_count = 0;
+
+        /// Stores the time, in microseconds, at which the oldest buffered reception code was received.
+        uint32_t _reception_code_window_start = 0;
+#endif
+
+#if AXMC_ENABLE_PRIORITY_SCHEDULING
+        /// Stores the index of the module from which to start searching for the next low-priority module to run.
+        size_t _next_low_priority_module = 0;
+#endif
+
+#if AXMC_SEQUENCE_STEP_COUNT > 0
+        static_assert(
+            AXMC_SEQUENCE_STEP_COUNT <= Communication::get_maximum_sequence_step_count(),
+            "The AXMC_SEQUENCE_STEP_COUNT cannot exceed the number of sequence steps that fit into a single received "
+            "message payload (see the AXMC_MAXIMUM_RECEIVED_PAYLOAD_SIZE build flag)."
+        );
+
+        /// Defines the execution stages of the current command sequence program step iteration.
+        enum class kSequenceStages : uint8_t
+        {
+            kIdle         = 0,  ///< The program is not running.
+            kQueueCommand = 1,  ///< The iteration has to queue the step's command.
+            kAwaitEvent   = 2,  ///< The iteration waits for the target module to send the awaited event.
+            kAwaitDelay   = 3,  ///< The iteration waits for the step's delay to expire.
+        };
+
+        /// Stores the steps of the loaded command sequence program.
+        SequenceStep _sequence_steps[AXMC_SEQUENCE_STEP_COUNT] = {};  // NOLINT(*-avoid-c-arrays)
+
+        /// Stores the index of the module addressed by each sequence step in the _modules array.
+        uint16_t _sequence_targets[AXMC_SEQUENCE_STEP_COUNT] = {};  // NOLINT(*-avoid-c-arrays)
+
+        /// Stores the number of steps in the loaded command sequence program.
+        uint8_t _sequence_step_count = 0;
+
+        /// Stores the number of times to run the loaded program. 0 repeats the program until it is stopped.
+        uint16_t _sequence_repeat_count = 0;
+
+        /// Tracks the number of completed runs of the program.
+        uint16_t _sequence_completed_runs = 0;
+
+        /// Stores the position of the currently executed step in the _sequence_steps array.
+        uint8_t _sequence_position = 0;
+
+        /// Tracks the number of completed iterations of the currently executed step.
+        uint8_t _sequence_iteration = 0;
+
+        /// Stores the execution stage of the current step iteration.
+        kSequenceStages _sequence_stage = kSequenceStages::kIdle;
+
+        /// Measures the delay of the current step iteration.
+        elapsedMicros _sequence_timer;
+#endif
+
+#if AXMC_ENABLE_RECEPTION_BUDGET
+        /// Tracks the number of runtime cycles whose data reception loop exhausted the reception budget while more
+        /// received data was waiting to be processed.
+        uint32_t _reception_budget_overruns = 0;
+#endif
+
+#if AXMC_DROP_REPORT_INTERVAL > 0
+        /// Measures the time elapsed since the last dropped message report.
+        elapsedMicros _since_drop_report;
+#endif
+
         /// Stores the unique identifier code of the microcontroller that uses the Kernel instance.
         const uint8_t _controller_id;
 
@@ -385,10 +1002,90 @@ class Kernel
         /// Stores the Communication instance used to bidirectionally communicate with the PC interface.
         Communication& _communication;
 
+        /// Stores the Communication instance used by the managed modules to send the bulk-data messages to the PC.
+        /// nullptr if all messages are sent via the control Communication instance.
+        Communication* _data_communication = nullptr;
+
         /// Determines whether the Setup() method has been called to ensure that the instance is properly configured for
         /// runtime.
         bool _setup_complete = false;
 
+        /// Stores the index of the module whose blocking command is waiting for a delay registered via the
+        /// YieldForMicros() method. While set, the Kernel does not run the commands of other modules. -1 if no module
+        /// holds the command execution.
+        int16_t _blocking_module = -1;
+
+        /**
+         * @brief Reserves the static storage for the per-module data array of a Kernel instance that manages the
+         * specified number of modules.
+         *
+         * @note Since the library requires a single Kernel instance per runtime, this avoids dynamic memory allocation
+         * while keeping the Kernel constructor interface independent of the number of managed modules.
+         *
+         * @tparam T The type of the array elements.
+         * @tparam kModuleNumber The number of modules managed by the Kernel instance.
+         *
+         * @returns The pointer to the first element of the reserved array.
+         */
+        template <typename T, const size_t kModuleNumber>
+        static T* ReserveStorage()
+        {
+            static T storage[kModuleNumber];  // NOLINT(*-avoid-c-arrays)
+            return storage;
+        }
+
+        /**
+         * @brief Fills the module lookup table and sorts it by the combined type and ID code of each managed module.
+         *
+         * @note If this method finds multiple modules that use the same combined type and ID code or a module that uses
+         * the reserved broadcast ID, it automatically sends an error message to the PC in addition to returning
+         * 'false'.
+         *
+         * @returns true if the lookup table was built, false if the combined type and ID codes of the managed modules
+         * are not unique or use the reserved broadcast ID.
+         */
+        bool BuildLookupTable()
+        {
+            // Uses insertion sort, which is efficient for the small number of modules typically managed by the Kernel
+            // and does not require additional memory.
+            for (size_t i = 0; i < _module_count; i++)
+            {
+                const ModuleLookupEntry entry {_modules[i]->get_module_type_id(), static_cast<uint16_t>(i)};
+                size_t position = i;
+                while (position > 0 && _lookup_table[position - 1].type_id > entry.type_id)
+                {
+                    _lookup_table[position] = _lookup_table[position - 1];
+                    position--;
+                }
+                _lookup_table[position] = entry;
+
+                // The broadcast ID addresses all modules of the same type, so it cannot be used by a single module.
+                if (_modules[i]->get_module_id() == kBroadcastModuleId)
+                {
+                    const uint8_t error_object[2] = {_modules[i]->get_module_type(), _modules[i]->get_module_id()};
+                    SendData(static_cast<uint8_t>(kKernelStatusCodes::kReservedModuleID), error_object);
+                    return false;
+                }
+            }
+
+            // Since the table is sorted, any modules that share the same type and ID code are stored next to each
+            // other.
+            for (size_t i = 1; i < _module_count; i++)
+            {
+                if (_lookup_table[i].type_id == _lookup_table[i - 1].type_id)
+                {
+                    const uint8_t error_object[2] = {
+                        static_cast<uint8_t>(_lookup_table[i].type_id >> 8),
+                        static_cast<uint8_t>(_lookup_table[i].type_id & 0xFF),
+                    };
+                    SendData(static_cast<uint8_t>(kKernelStatusCodes::kDuplicateModuleTypeID), error_object);
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
         /**
          * @brief If a message sent from the PC is available for reception, decodes it into the Communication's
          * reception buffer.
@@ -490,6 +1187,38 @@ class Kernel
             }
         }
 
+#if AXMC_RECEPTION_CODE_BATCH_SIZE > 0
+        /**
+         * @brief Buffers the input reception code to be sent to the PC together with other reception codes.
+         *
+         * @note If this fills the reception code buffer, sends all buffered codes to the PC.
+         *
+         * @param reception_code The reception code received as part of an incoming message sent from the PC.
+         */
+        void SendReceptionCode(const uint8_t reception_code)
+        {
+            if (_reception_code_count == 0) _reception_code_window_start = micros();
+            _reception_codes[_reception_code_count++] = reception_code;
+            if (_reception_code_count == AXMC_RECEPTION_CODE_BATCH_SIZE) SendReceptionCodes();
+        }
+
+        /// Sends all buffered reception codes to the PC.
+        void SendReceptionCodes()
+        {
+            _communication.SendReceptionCodes(_reception_codes, _reception_code_count);
+            _reception_code_count = 0;
+        }
+
+        /// Sends the buffered reception codes to the PC if the oldest buffered code exceeds the reception code window.
+        void ResolveReceptionCodes()
+        {
+            if (_reception_code_count == 0) return;
+#if AXMC_RECEPTION_CODE_WINDOW > 0
+            if (micros() - _reception_code_window_start < AXMC_RECEPTION_CODE_WINDOW) return;
+#endif
+            SendReceptionCodes();
+        }
+#else
         /**
          * @brief Sends the input reception code to the PC.
          *
@@ -499,29 +1228,108 @@ class Kernel
         {
             _communication.SendServiceMessage<kProtocols::kReceptionCode>(reception_code);
         }
+#endif
 
+#if AXMC_DROP_REPORT_INTERVAL > 0
         /**
-         * @brief Sets up the hardware and software assets managed by the Kernel class.
+         * @brief Sends the number of droppable messages dropped by each managed module since the previous report to
+         * the PC and resets the modules' dropped message counters.
+         *
+         * @note Each report is sent as a kMessagesDropped Kernel message that stores the combined type and ID code of
+         * the module and the number of dropped messages. Modules that did not drop any messages are not reported.
          */
-        void SetupKernel()
+        void ReportDroppedMessages()
         {
-            // Configures and deactivates the built-in LED. Currently, this is the only hardware system directly
-            // managed by the Kernel.
-            pinModeFast(LED_BUILTIN, OUTPUT);
-            digitalWriteFast(LED_BUILTIN, LOW);
+            _since_drop_report = 0;
+            for (size_t i = 0; i < _module_count; i++)
+            {
+                const uint32_t dropped = _modules[i]->get_dropped_messages();
+                if (dropped == 0) continue;
 
-            // Disables the keepalive tracking.
-            _keepalive_enabled = false;
+                const uint32_t report[2] = {_modules[i]->get_module_type_id(), dropped};  // NOLINT(*-avoid-c-arrays)
+                SendData(static_cast<uint8_t>(kKernelStatusCodes::kMessagesDropped), report);
+                _modules[i]->ResetDroppedMessages();
+            }
         }
+#endif
 
+#if AXMC_ENABLE_MESSAGE_TIMESTAMPS
         /**
-         * @brief Resolves and calls the method associated with the currently active Kernel command.
+         * @brief Sends the controller time at which the clock synchronization command was processed to the PC.
+         *
+         * The sent message's header also stores the controller time at which the response was packaged. Together with
+         * the PC times at which the command was sent and the response was received, this allows the PC to estimate
+         * the offset between the PC and controller clocks.
+         *
+         * @note The response bypasses the message batching to minimize the transmission delay.
          */
-        void RunKernelCommand()
+        void SendClockSynchronization()
         {
-            // Resolves and executes the specific requested command
-            _kernel_command = _communication.get_kernel_command().command;
-            switch (static_cast<kKernelCommands>(_kernel_command))
+            const uint64_t reception_time = _communication.GetTimestamp();
+            SendData(static_cast<uint8_t>(kKernelStatusCodes::kClockSynchronization), reception_time);
+            _communication.SendBatchedMessages();
+        }
+
+        /**
+         * @brief Queues the command from the received ScheduledModuleCommand message for execution by each addressed
+         * module at the requested controller time.
+         *
+         * @note If the requested activation time is 2^31 microseconds (~35 minutes) or more in the future, this method
+         * sends an error message to the PC instead of queueing the command. Commands whose activation time has
+         * already passed are queued for immediate execution.
+         */
+        void ScheduleModuleCommand()
+        {
+            const ScheduledModuleCommand& message = _communication.get_scheduled_module_command();
+            if (message.return_code) SendReceptionCode(message.return_code);
+
+            // The lower 32 bits of the 64-bit controller time match the micros() timer value used by the modules to
+            // resolve the activation time.
+            const uint64_t now = _communication.GetTimestamp();
+            if (message.activation_time > now && message.activation_time - now > kMaximumActivationDelay)
+            {
+                const uint8_t error_object[2] = {message.module_type, message.module_id};
+                SendData(static_cast<uint8_t>(kKernelStatusCodes::kInvalidActivationTime), error_object);
+                return;
+            }
+            const auto activation_time = static_cast<uint32_t>(max(message.activation_time, now));
+
+            ForEachTargetModule(
+                message.module_type,
+                message.module_id,
+                [this, &message, activation_time](const size_t index)
+                {
+                    _modules[index]->ScheduleCommand(message.command, message.noblock, activation_time);
+#if AXMC_ENABLE_DEADLINE_SCHEDULER
+                    WakeModule(index);
+#endif
+                }
+            );
+        }
+#endif
+
+        /**
+         * @brief Sets up the hardware and software assets managed by the Kernel class.
+         */
+        void SetupKernel()
+        {
+            // Configures and deactivates the built-in LED. Currently, this is the only hardware system directly
+            // managed by the Kernel.
+            pinModeFast(LED_BUILTIN, OUTPUT);
+            digitalWriteFast(LED_BUILTIN, LOW);
+
+            // Disables the keepalive tracking.
+            _keepalive_enabled = false;
+        }
+
+        /**
+         * @brief Resolves and calls the method associated with the currently active Kernel command.
+         */
+        void RunKernelCommand()
+        {
+            // Resolves and executes the specific requested command
+            _kernel_command = _communication.get_kernel_command().command;
+            switch (static_cast<kKernelCommands>(_kernel_command))
             {
                 case kKernelCommands::kResetController: Setup(); return;
 
@@ -538,12 +1346,77 @@ class Kernel
                     _since_previous_keepalive = 0;
                     return;
 
+#if AXMC_ENABLE_PERFORMANCE_TELEMETRY
+                case kKernelCommands::kReportPerformance: SendPerformanceReport(); return;
+#endif
+
+#if AXMC_ENABLE_MESSAGE_TIMESTAMPS
+                case kKernelCommands::kSynchronizeClock: SendClockSynchronization(); return;
+#endif
+
+#if AXMC_SEQUENCE_STEP_COUNT > 0
+                case kKernelCommands::kStartSequence: StartSequence(); return;
+
+                case kKernelCommands::kStopSequence: StopSequence(); return;
+#endif
+
                 default:
                     // If the command code was not matched with any valid code, sends an error message.
                     SendData(static_cast<uint8_t>(kKernelStatusCodes::kCommandNotRecognized));
             }
         }
 
+        /**
+         * @brief Applies the parameters from the received ModuleParameters or PartialModuleParameters message to each
+         * addressed module.
+         *
+         * @note If the message is addressed to the kBroadcastModuleId, buffers the parameter data before the addressed
+         * modules extract it, so that all modules of the addressed type receive the same parameters. Notifies the PC
+         * whether each addressed module applied the parameters.
+         */
+        void ApplyModuleParameters()
+        {
+            const uint8_t target_type = _communication.get_module_parameters_header().module_type;
+            const uint8_t target_id   = _communication.get_module_parameters_header().module_id;
+
+            // Since each module consumes the parameter data when it extracts the data from the reception buffer, the
+            // broadcast parameters are extracted once and then shared by all addressed modules.
+            if (target_id == kBroadcastModuleId && !_communication.BufferModuleParameters())
+            {
+                const uint8_t error_object[2] = {target_type, target_id};
+                SendData(static_cast<uint8_t>(kKernelStatusCodes::kModuleParametersError), error_object);
+                return;
+            }
+
+            ForEachTargetModule(
+                target_type,
+                target_id,
+                [this](const size_t index)
+                {
+                    // Calls the Module API method that processes the parameter object included with the message
+                    if (!ModuleDispatcher::VisitModule(
+                            _modules,
+                            index,
+                            [](auto& module) { return ModuleDispatcher::SetCustomParameters(module); }
+                        ))
+                    {
+                        // If the module fails to process the parameters, as indicated by the API method returning
+                        // 'false', sends an error message to the PC to communicate the error.
+                        const uint8_t error_object[2] = {
+                            _modules[index]->get_module_type(),
+                            _modules[index]->get_module_id(),
+                        };
+                        SendData(static_cast<uint8_t>(kKernelStatusCodes::kModuleParametersError), error_object);
+                    }
+                    else
+                    {
+                        // If the parameters were set correctly, notifies the PC.
+                        SendData(static_cast<uint8_t>(kKernelStatusCodes::kModuleParametersSet));
+                    }
+                }
+            );
+        }
+
         /**
          * @brief Finds the managed hardware module instance addressed by the input type and id codes.
          *
@@ -558,14 +1431,13 @@ class Kernel
          */
         int16_t ResolveTargetModule(const uint8_t target_type, const uint8_t target_id)
         {
-            // Loops over all managed modules and checks the type and id of each module against the searched parameters.
-            for (size_t i = 0; i < _module_count; i++)
+            const auto target_type_id = static_cast<uint16_t>(target_type << 8 | target_id);
+            const size_t position     = FindLookupPosition(target_type_id);
+
+            // If the matching module is found, returns its index in the array of managed modules.
+            if (position < _module_count && _lookup_table[position].type_id == target_type_id)
             {
-                // If the matching module is found, returns its index in the array of managed modules.
-                if (_modules[i]->get_module_type() == target_type && _modules[i]->get_module_id() == target_id)
-                {
-                    return static_cast<int16_t>(i);
-                }
+                return static_cast<int16_t>(_lookup_table[position].index);
             }
 
             // Otherwise, sends an error message to the PC and returns -1 to indicate that the target module was not
@@ -575,27 +1447,659 @@ class Kernel
             return -1;
         }
 
+        /**
+         * @brief Calls the input callback with the index of each managed hardware module instance addressed by the
+         * input type and id codes.
+         *
+         * If the target id is the kBroadcastModuleId, calls the callback for every managed module of the target type in
+         * the ascending order of module IDs. Otherwise, calls the callback for the single module that uses the target
+         * type and id codes.
+         *
+         * @note If this method is unable to resolve any target module, it automatically sends an error message to the
+         * PC.
+         *
+         * @tparam Callback The type of the callback invoked for each addressed module.
+         * @param target_type The type (family) identifier of the addressed module(s).
+         * @param target_id The unique identifier of the addressed module or the kBroadcastModuleId.
+         * @param callback The callback to invoke with the index of each addressed module in the array of managed
+         * modules.
+         */
+        template <typename Callback>
+        void ForEachTargetModule(const uint8_t target_type, const uint8_t target_id, Callback&& callback)
+        {
+            if (target_id != kBroadcastModuleId)
+            {
+                const int16_t target_module = ResolveTargetModule(target_type, target_id);
+                if (target_module >= 0) callback(static_cast<size_t>(target_module));
+                return;
+            }
+
+            // Since the lookup table is sorted and no module can use the broadcast ID, all modules of the target type
+            // are stored between the positions of the lowest and the broadcast ID of that type.
+            const size_t first = FindLookupPosition(static_cast<uint16_t>(target_type << 8));
+            const size_t last  = FindLookupPosition(static_cast<uint16_t>(target_type << 8 | kBroadcastModuleId));
+            if (first == last)
+            {
+                const uint8_t errors[2] = {target_type, target_id};
+                SendData(static_cast<uint8_t>(kKernelStatusCodes::kTargetModuleNotFound), errors);
+                return;
+            }
+
+            for (size_t position = first; position < last; position++) callback(_lookup_table[position].index);
+        }
+
+        /**
+         * @brief Uses binary search to find the position of the first module lookup table entry whose combined type and
+         * ID code is not less than the input code.
+         *
+         * @param target_type_id The searched combined type and ID code.
+         *
+         * @returns The position of the found lookup table entry or the number of managed modules if all entries use
+         * smaller codes.
+         */
+        [[nodiscard]]
+        size_t FindLookupPosition(const uint16_t target_type_id) const
+        {
+            size_t low  = 0;
+            size_t high = _module_count;
+            while (low < high)
+            {
+                const size_t middle = low + (high - low) / 2;
+                if (_lookup_table[middle].type_id < target_type_id) low = middle + 1;
+                else high = middle;
+            }
+            return low;
+        }
+
+#if AXMC_SEQUENCE_STEP_COUNT > 0
+        /**
+         * @brief Replaces the loaded command sequence program with the program from the received SequenceProgram
+         * message.
+         *
+         * @note Stops the running program, if any. If the received program is malformed or addresses a module not
+         * managed by the Kernel, sends an error message to the PC and unloads the current program. Otherwise, notifies
+         * the PC that the program was loaded.
+         */
+        void LoadSequence()
+        {
+            const SequenceProgram& header = _communication.get_sequence_program_header();
+            if (header.return_code) SendReceptionCode(header.return_code);
+
+            StopSequence();
+            _sequence_step_count  = 0;
+            _sequence_repeat_count = header.repeat_count;
+
+            uint8_t step_count = 0;
+            if (!_communication.ExtractSequenceSteps(_sequence_steps, step_count))
+            {
+                SendData(static_cast<uint8_t>(kKernelStatusCodes::kSequenceError));
+                return;
+            }
+
+            // Resolves the module addressed by each step in advance, so that running the program does not require
+            // searching the lookup table. Includes the position of the first invalid step with the error message.
+            for (uint8_t i = 0; i < step_count; i++)
+            {
+                const SequenceStep& step  = _sequence_steps[i];
+                const auto target_type_id = static_cast<uint16_t>(step.module_type << 8 | step.module_id);
+                const size_t position     = FindLookupPosition(target_type_id);
+                if (step.iteration_count == 0 || position == _module_count ||
+                    _lookup_table[position].type_id != target_type_id)
+                {
+                    SendData(static_cast<uint8_t>(kKernelStatusCodes::kSequenceError), i);
+                    return;
+                }
+                _sequence_targets[i] = _lookup_table[position].index;
+            }
+
+            _sequence_step_count = step_count;
+            SendData(static_cast<uint8_t>(kKernelStatusCodes::kSequenceLoaded), step_count);
+        }
+
+        /**
+         * @brief Starts running the loaded command sequence program from its first step.
+         *
+         * @note If no program is loaded, sends an error message to the PC.
+         */
+        void StartSequence()
+        {
+            if (_sequence_step_count == 0)
+            {
+                SendData(static_cast<uint8_t>(kKernelStatusCodes::kSequenceError));
+                return;
+            }
+
+            StopSequence();
+            _sequence_position       = 0;
+            _sequence_iteration      = 0;
+            _sequence_completed_runs = 0;
+            _sequence_stage          = kSequenceStages::kQueueCommand;
+        }
+
+        /**
+         * @brief Stops running the command sequence program.
+         *
+         * @note Calling this method does not abort the module commands already queued by the program.
+         */
+        void StopSequence()
+        {
+            if (_sequence_stage == kSequenceStages::kAwaitEvent)
+            {
+                _modules[_sequence_targets[_sequence_position]]->AwaitEvent(0);
+            }
+            _sequence_stage = kSequenceStages::kIdle;
+        }
+
+        /**
+         * @brief Advances the running command sequence program through all step iterations that are due during the
+         * current runtime cycle.
+         *
+         * @note To avoid stalling the runtime cycle, each call processes at most as many step iterations as there are
+         * steps in the program.
+         */
+        void RunSequence()
+        {
+            for (size_t processed = 0; processed < _sequence_step_count; processed++)
+            {
+                if (_sequence_stage == kSequenceStages::kIdle) return;
+
+                const SequenceStep& step = _sequence_steps[_sequence_position];
+                const uint16_t target    = _sequence_targets[_sequence_position];
+
+                if (_sequence_stage == kSequenceStages::kQueueCommand)
+                {
+                    // Starts tracking the awaited event before queueing the command to capture all events sent by
+                    // the command.
+                    if (step.awaited_event != 0) _modules[target]->AwaitEvent(step.awaited_event);
+                    if (step.command != 0)
+                    {
+                        // If the module cannot queue the command, stops the program, as its remaining steps rely on
+                        // the skipped command. Includes the position of the failed step with the error message.
+                        if (!_modules[target]->QueueCommand(step.command, step.noblock))
+                        {
+                            _modules[target]->AwaitEvent(0);
+                            _sequence_stage = kSequenceStages::kIdle;
+                            SendData(static_cast<uint8_t>(kKernelStatusCodes::kSequenceError), _sequence_position);
+                            return;
+                        }
+#if AXMC_ENABLE_DEADLINE_SCHEDULER
+                        WakeModule(target);
+#endif
+                    }
+                    _sequence_stage =
+                        step.awaited_event != 0 ? kSequenceStages::kAwaitEvent : kSequenceStages::kAwaitDelay;
+                    _sequence_timer = 0;
+                }
+
+                if (_sequence_stage == kSequenceStages::kAwaitEvent)
+                {
+                    if (!_modules[target]->is_awaited_event_sent()) return;
+                    _modules[target]->AwaitEvent(0);
+                    _sequence_stage = kSequenceStages::kAwaitDelay;
+                    _sequence_timer = 0;
+                }
+
+                if (_sequence_timer < step.delay) return;
+
+                // Advances to the next iteration of the step, the next step, or the next run of the program.
+                _sequence_stage = kSequenceStages::kQueueCommand;
+                if (++_sequence_iteration < step.iteration_count) continue;
+                _sequence_iteration = 0;
+                if (++_sequence_position < _sequence_step_count) continue;
+                _sequence_position = 0;
+                if (_sequence_repeat_count == 0 || ++_sequence_completed_runs < _sequence_repeat_count) continue;
+
+                _sequence_stage = kSequenceStages::kIdle;
+                SendData(static_cast<uint8_t>(kKernelStatusCodes::kSequenceCompleted));
+            }
+        }
+#endif
+
         /**
          * @brief Resolves and, if necessary, executes the active command for each managed hardware module.
          */
-        void RunModuleCommands() const
+        void RunModuleCommands()
         {
-            // Loops over all managed modules
+#if AXMC_ENABLE_DEADLINE_SCHEDULER
+            // Marks all modules whose delays have expired since the previous runtime cycle as ready to be polled.
+            WakeExpiredModules();
+#endif
+
+#if AXMC_ENABLE_PRIORITY_SCHEDULING
+            // Runs high-priority modules first.
+            RunModuleTier(Module::kExecutionPriorities::kHigh);
+
+            // Runs each normal-priority module. Every time a normal-priority module executes a command, runs the
+            // high-priority modules again to bound their response time.
+            ModuleDispatcher::ForEachModule(
+                _modules,
+                _module_count,
+                [this](auto& module, const size_t index)
+                {
+                    if (module.get_execution_priority() != Module::kExecutionPriorities::kNormal) return;
+                    if (RunModuleCommand(module, index)) RunModuleTier(Module::kExecutionPriorities::kHigh);
+                }
+            );
+
+            // Runs low-priority modules in a round-robin order until the time budget is exhausted, starting with the
+            // module that follows the last low-priority module run during the previous cycle.
+            const uint32_t low_priority_start = micros();
             for (size_t i = 0; i < _module_count; i++)
             {
-                // First, determines which command to run, if any. This relies on the following choice hierarchy:
-                // finish already active commands > execute a newly queued command > repeat a cyclic command.
-                // If this method is able to resolve (activate) a command, it returns 'true'. Otherwise, there is no
-                // command to run. If the module has no active command, aborts the iteration early to conserve CPU
-                // cycles and speed up looping through modules.
-                if (!_modules[i]->ResolveActiveCommand()) continue;
+                const size_t index = _next_low_priority_module;
+                _next_low_priority_module = (index + 1) % _module_count;
+                if (_modules[index]->get_execution_priority() != Module::kExecutionPriorities::kLow) continue;
+
+                const bool executed = ModuleDispatcher::VisitModule(
+                    _modules,
+                    index,
+                    [this, index](auto& module) { return RunModuleCommand(module, index); }
+                );
+                if (executed) RunModuleTier(Module::kExecutionPriorities::kHigh);
+
+                if (micros() - low_priority_start >= AXMC_LOW_PRIORITY_TIME_BUDGET) break;
+            }
+#else
+            // Loops over all managed modules
+            ModuleDispatcher::ForEachModule(
+                _modules,
+                _module_count,
+                [this](auto& module, const size_t index) { RunModuleCommand(module, index); }
+            );
+#endif
+        }
+
+#if AXMC_ENABLE_PRIORITY_SCHEDULING
+        /// Resolves and, if necessary, executes the active command for each managed module that uses the specified
+        /// execution priority class.
+        void RunModuleTier(const Module::kExecutionPriorities priority)
+        {
+#if AXMC_ENABLE_DEADLINE_SCHEDULER
+            // Since this method runs multiple times per cycle, marks the modules whose delays have expired since the
+            // previous tier run as ready to be polled.
+            WakeExpiredModules();
+#endif
+
+            ModuleDispatcher::ForEachModule(
+                _modules,
+                _module_count,
+                [this, priority](auto& module, const size_t index)
+                {
+                    if (module.get_execution_priority() == priority) RunModuleCommand(module, index);
+                }
+            );
+        }
+#endif
+
+        /**
+         * @brief Resolves and, if necessary, executes the active command of the input hardware module.
+         *
+         * @tparam ModuleType The type of the module instance, used to call the module's custom API methods.
+         * @param module The module instance whose command to run.
+         * @param index The index of the module in the array of managed modules.
+         *
+         * @returns true if the module executed a command stage, false otherwise.
+         */
+        template <typename ModuleType>
+        bool RunModuleCommand(ModuleType& module, const size_t index)
+        {
+#if AXMC_ENABLE_TIMER_EXECUTION
+            // Sends the events reported by the module's timer-executed command, if any, to the PC.
+            module.SendTimedEvents();
+#endif
+
+            // While a blocking command waits for its delay to expire, only its module is allowed to run commands. The
+            // hold is released early if the command is no longer active, for example, due to being dequeued.
+            if (_blocking_module >= 0)
+            {
+                if (static_cast<size_t>(_blocking_module) != index) return false;
+                if (!module.is_blocking_suspended()) _blocking_module = -1;
+            }
 
+#if AXMC_ENABLE_DEADLINE_SCHEDULER
+            // Skips the modules that are idle or are waiting for their delays to expire.
+            if (!_schedule_states[index].ready) return false;
+#endif
+
+            // First, determines which command to run, if any. This relies on the following choice hierarchy:
+            // finish already active commands > execute a newly queued command > repeat a cyclic command.
+            // If this method is able to resolve (activate) a command, it returns 'true'. Otherwise, there is no
+            // command to run.
+            const bool executed = module.ResolveActiveCommand();
+            if (executed)
+            {
                 // If RunActiveCommand is implemented properly, it returns 'true' if it matches the active command
-                // code to the method to execute and 'false' otherwise. If the method returns 'false', the Kernel calls
-                // an API method to send a predetermined error message to the PC.
-                if (!_modules[i]->RunActiveCommand()) _modules[i]->SendCommandActivationError();
+                // code to the method to execute and 'false' otherwise. If the method returns 'false', the Kernel
+                // calls an API method to send a predetermined error message to the PC.
+#if AXMC_ENABLE_PERFORMANCE_TELEMETRY
+                const uint32_t command_start = micros();
+#endif
+                if (!ModuleDispatcher::RunActiveCommand(module)) module.SendCommandActivationError();
+#if AXMC_ENABLE_PERFORMANCE_TELEMETRY
+                RecordDuration(_module_timings[index], micros() - command_start);
+#endif
+                // If the executed command runs in the blocking mode and yielded to wait for a delay, holds the command
+                // execution of all other modules until the delay expires.
+                _blocking_module = module.is_blocking_suspended() ? static_cast<int16_t>(index) : -1;
+            }
+
+#if AXMC_ENABLE_DEADLINE_SCHEDULER
+            // Determines when the module has to be polled next.
+            UpdateModuleSchedule(index);
+#else
+            static_cast<void>(index);
+#endif
+
+            return executed;
+        }
+
+#if AXMC_ENABLE_PERFORMANCE_TELEMETRY
+        /// Adds the input duration, in microseconds, to the specified duration statistics.
+        static void RecordDuration(TimingStatistics& statistics, const uint32_t duration)
+        {
+            statistics.count++;
+            statistics.total += duration;
+            if (duration < statistics.minimum) statistics.minimum = duration;
+            if (duration > statistics.maximum) statistics.maximum = duration;
+        }
+
+        /// Returns the index of the runtime cycle duration histogram bucket that counts the input duration, in
+        /// microseconds.
+        static size_t GetHistogramBucket(uint32_t duration)
+        {
+            size_t bucket = 0;
+            while (duration != 0 && bucket < kHistogramBucketCount - 1)
+            {
+                duration >>= 1;
+                bucket++;
+            }
+            return bucket;
+        }
+
+        /**
+         * @brief Packages the input duration statistics into the array transmitted to the PC.
+         *
+         * @param statistics The duration statistics to package.
+         * @param report The array that stores the number of measurements, the minimum, maximum, and mean duration, in
+         * microseconds, in that order.
+         */
+        static void PackageTiming(const TimingStatistics& statistics, uint32_t* report)
+        {
+            report[0] = statistics.count;
+            report[1] = statistics.count != 0 ? statistics.minimum : 0;
+            report[2] = statistics.maximum;
+            report[3] = statistics.count != 0 ? static_cast<uint32_t>(statistics.total / statistics.count) : 0;
+        }
+
+        /**
+         * @brief Sends the runtime performance statistics collected since the previous report to the PC and resets
+         * the statistics.
+         *
+         * The report consists of the runtime cycle statistics, the data reception loop statistics, the cycle duration
+         * histogram, and one message for each managed module that includes the module's combined type and ID code
+         * followed by the module's command execution statistics.
+         */
+        void SendPerformanceReport()
+        {
+            uint32_t timing[4];  // NOLINT(*-avoid-c-arrays)
+
+            PackageTiming(_cycle_timing, timing);
+            SendData(static_cast<uint8_t>(kKernelStatusCodes::kCyclePerformance), timing);
+            _cycle_timing = {};
+
+            PackageTiming(_reception_timing, timing);
+            SendData(static_cast<uint8_t>(kKernelStatusCodes::kReceptionPerformance), timing);
+            _reception_timing = {};
+
+            SendData(static_cast<uint8_t>(kKernelStatusCodes::kCycleHistogram), _cycle_histogram);
+            for (uint32_t& bucket : _cycle_histogram) bucket = 0;
+
+            for (size_t i = 0; i < _module_count; i++)
+            {
+                uint32_t module_timing[5] = {_modules[i]->get_module_type_id()};  // NOLINT(*-avoid-c-arrays)
+                PackageTiming(_module_timings[i], module_timing + 1);
+                SendData(static_cast<uint8_t>(kKernelStatusCodes::kModulePerformance), module_timing);
+                _module_timings[i] = {};
+            }
+
+#if AXMC_ENABLE_RECEPTION_BUDGET
+            SendData(static_cast<uint8_t>(kKernelStatusCodes::kReceptionBudgetReached), _reception_budget_overruns);
+            _reception_budget_overruns = 0;
+#endif
+        }
+#endif
+
+#if AXMC_ENABLE_RECEPTION_BUDGET
+        /**
+         * @brief Determines whether the data reception loop of the current runtime cycle has exhausted the reception
+         * budget.
+         *
+         * @param processed_messages The number of messages processed by the reception loop.
+         * @param reception_start The time, in microseconds, at which the reception loop started.
+         *
+         * @returns true if the loop has to end before processing any more messages, false otherwise.
+         */
+        static bool IsReceptionBudgetExhausted(const size_t processed_messages, const uint32_t reception_start)
+        {
+#if AXMC_RECEPTION_MESSAGE_BUDGET > 0
+            if (processed_messages >= AXMC_RECEPTION_MESSAGE_BUDGET) return true;
+#else
+            static_cast<void>(processed_messages);
+#endif
+#if AXMC_RECEPTION_TIME_BUDGET > 0
+            if (micros() - reception_start >= AXMC_RECEPTION_TIME_BUDGET) return true;
+#else
+            static_cast<void>(reception_start);
+#endif
+            return false;
+        }
+#endif
+
+#if AXMC_ENABLE_DEADLINE_SCHEDULER
+        /// Returns true if the first input time, in microseconds, precedes the second input time. Accounts for the
+        /// overflow of the microsecond timer.
+        static bool IsEarlier(const uint32_t first, const uint32_t second)
+        {
+            return static_cast<int32_t>(first - second) < 0;
+        }
+
+        /// Empties the schedule heap and marks all managed modules as ready to be polled for commands.
+        void ResetSchedule()
+        {
+            _schedule_size = 0;
+            for (size_t i = 0; i < _module_count; i++)
+            {
+                _schedule_states[i].heap_position = kNotScheduled;
+                _schedule_states[i].ready         = true;
             }
         }
+
+        /// Stores the input entry at the specified position of the schedule heap and updates the position tracker of
+        /// the entry's module.
+        void PlaceScheduleEntry(const size_t position, const ScheduleEntry& entry)
+        {
+            _schedule[position]                                  = entry;
+            _schedule_states[entry.module_index].heap_position = static_cast<uint16_t>(position);
+        }
+
+        /// Restores the heap order by moving the entry stored at the specified position towards the top or the bottom
+        /// of the schedule heap.
+        void RestoreScheduleOrder(size_t position)
+        {
+            const ScheduleEntry entry = _schedule[position];
+
+            // Moves the entry towards the top of the heap while it expires earlier than its parent.
+            while (position > 0 && IsEarlier(entry.wake_time, _schedule[(position - 1) / 2].wake_time))
+            {
+                PlaceScheduleEntry(position, _schedule[(position - 1) / 2]);
+                position = (position - 1) / 2;
+            }
+
+            // Moves the entry towards the bottom of the heap while any of its children expires earlier than the
+            // entry.
+            while (true)
+            {
+                size_t child = 2 * position + 1;
+                if (child >= _schedule_size) break;
+                if (child + 1 < _schedule_size && IsEarlier(_schedule[child + 1].wake_time, _schedule[child].wake_time))
+                {
+                    child++;
+                }
+                if (!IsEarlier(_schedule[child].wake_time, entry.wake_time)) break;
+                PlaceScheduleEntry(position, _schedule[child]);
+                position = child;
+            }
+
+            PlaceScheduleEntry(position, entry);
+        }
+
+        /// Removes the specified module from the schedule heap, if it is stored in the heap.
+        void RemoveFromSchedule(const size_t module_index)
+        {
+            const uint16_t position = _schedule_states[module_index].heap_position;
+            if (position == kNotScheduled) return;
+
+            _schedule_states[module_index].heap_position = kNotScheduled;
+            _schedule_size--;
+
+            // Replaces the removed entry with the last entry of the heap and restores the heap order.
+            if (position < _schedule_size)
+            {
+                PlaceScheduleEntry(position, _schedule[_schedule_size]);
+                RestoreScheduleOrder(position);
+            }
+        }
+
+        /// Marks the specified module as ready to be polled for commands during the next runtime cycle.
+        void WakeModule(const size_t module_index)
+        {
+            RemoveFromSchedule(module_index);
+            _schedule_states[module_index].ready = true;
+        }
+
+        /// Marks all modules whose delays have expired as ready to be polled for commands.
+        void WakeExpiredModules()
+        {
+            const uint32_t now = micros();
+            while (_schedule_size > 0 && !IsEarlier(now, _schedule[0].wake_time))
+            {
+                WakeModule(_schedule[0].module_index);
+            }
+        }
+
+        /**
+         * @brief Determines when the specified module has to be polled for commands based on the state of the
+         * module's command queue.
+         *
+         * Modules that wait for a delay to expire are stored in the schedule heap until the delay expires. Modules
+         * without active, queued, or recurrent commands are not polled until they receive a new command from the PC.
+         * All other modules are polled during each runtime cycle.
+         */
+        void UpdateModuleSchedule(const size_t module_index)
+        {
+            const Module* module = _modules[module_index];
+
+            if (module->is_suspended())
+            {
+                _schedule_states[module_index].ready = false;
+
+                // Adds the module to the heap or updates the module's delay expiration time.
+                size_t position = _schedule_states[module_index].heap_position;
+                if (position == kNotScheduled) position = _schedule_size++;
+                PlaceScheduleEntry(position, {module->get_wake_time(), static_cast<uint16_t>(module_index)});
+                RestoreScheduleOrder(position);
+            }
+            else if (!module->has_pending_commands())
+            {
+                _schedule_states[module_index].ready = false;
+            }
+        }
+#endif
+};
+
+/**
+ * @brief Manages the runtime of one or more custom hardware module instances stored in an array of Module pointers.
+ *
+ * @note During initialization, this class should be provided with an array of hardware module instances
+ * that inherit from the Module class.
+ */
+using Kernel = BasicKernel<VirtualModuleDispatcher>;
+
+/**
+ * @brief Manages the runtime of a set of custom hardware module instances whose types are known at compile time.
+ *
+ * This class exposes the same runtime API as the Kernel class, but calls the SetupModule(), SetCustomParameters(), and
+ * RunActiveCommand() methods of the managed modules directly instead of via virtual dispatch. This allows the compiler
+ * to inline each module's command logic into the Kernel runtime cycle, which reduces the duration of each cycle for
+ * firmware builds that use a fixed set of hardware modules.
+ *
+ * @warning Each template argument must be the most-derived type of the matching module instance. Since the custom API
+ * methods are called directly, any overrides declared by the classes derived from the specified types are ignored.
+ *
+ * @tparam Modules The types of the managed hardware module instances. Usually, these are deduced from the
+ * constructor arguments.
+ */
+template <typename... Modules>
+class StaticKernel : private StaticModuleDispatcher<Modules...>, public BasicKernel<StaticModuleDispatcher<Modules...>>
+{
+    public:
+        /**
+         * @brief Initializes the necessary assets used to manage the runtime of the input hardware module instances.
+         *
+         * @param controller_id The unique identifier of the microcontroller that uses this Kernel instance. This
+         * ID code has to be unique for all microcontrollers used at the same time. Valid values range from 1 to 255;
+         * the value 0 is reserved.
+         * @param communication The shared Communication instance used to bidirectionally communicate with the PC
+         * during runtime.
+         * @param keepalive_interval The interval, in milliseconds, used to derive the keepalive timeout. Setting this
+         * parameter to 0 disables the keepalive mechanism. See the Kernel class for details.
+         * @param modules The custom hardware module instances. Each instance must inherit from the base Module class,
+         * and at least one instance must be provided.
+         */
+        StaticKernel(
+            const uint8_t controller_id,
+            Communication& communication,
+            const uint32_t keepalive_interval,
+            Modules&... modules
+        ) :
+            StaticModuleDispatcher<Modules...>(modules...),
+            BasicKernel<StaticModuleDispatcher<Modules...>>(
+                controller_id,
+                communication,
+                this->_module_array,
+                keepalive_interval
+            )
+        {}
+
+        /**
+         * @brief Initializes the necessary assets used to manage the runtime of the input hardware module instances
+         * that send their bulk-data messages via a dedicated Communication instance.
+         *
+         * @param controller_id The unique identifier of the microcontroller that uses this Kernel instance.
+         * @param communication The control Communication instance used to bidirectionally communicate with the PC
+         * during runtime.
+         * @param data_communication The Communication instance used by the managed modules to send the bulk-data
+         * messages to the PC.
+         * @param keepalive_interval The interval, in milliseconds, used to derive the keepalive timeout. Setting this
+         * parameter to 0 disables the keepalive mechanism.
+         * @param modules The custom hardware module instances.
+         */
+        StaticKernel(
+            const uint8_t controller_id,
+            Communication& communication,
+            Communication& data_communication,
+            const uint32_t keepalive_interval,
+            Modules&... modules
+        ) :
+            StaticModuleDispatcher<Modules...>(modules...),
+            BasicKernel<StaticModuleDispatcher<Modules...>>(
+                controller_id,
+                communication,
+                data_communication,
+                this->_module_array,
+                keepalive_interval
+            )
+        {}
 };
 
 #endif  //AXMC_KERNEL_H
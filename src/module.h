@@ -22,573 +22,2976 @@
 #include "communication.h"
 
 /**
- * @brief Provides the API used by other library components to integrate any custom hardware module class with
- * the interface running on the companion host-computer (PC).
+ * @def AXMC_COMMAND_QUEUE_SIZE
+ * @brief Determines the number of one-off (non-recurrent) commands each Module instance can queue for execution.
  *
- * Any class that inherits from this base class gains the API used by the Kernel and Communication classes to enable
- * bidirectionally interfacing with the module via the interface running on the companion host-computer (PC)
+ * One-off commands queued while the module is busy are executed in the order they were received. With the default
+ * single-command queue, each newly received command replaces the pending command instead. Increasing this value (for
+ * example, via the '-D AXMC_COMMAND_QUEUE_SIZE=4' build flag) allows the PC to submit multi-command sequences without
+ * waiting for each command to complete. Each additional queue slot reserves 2 bytes of RAM per module instance.
+ */
+#ifndef AXMC_COMMAND_QUEUE_SIZE
+#define AXMC_COMMAND_QUEUE_SIZE 1
+#endif
+
+/**
+ * @def AXMC_ENABLE_TIMER_EXECUTION
+ * @brief Determines whether Module instances can execute their recurrent commands from a hardware timer interrupt.
  *
- * @warning Every custom module class @b has to inherit from this base class. Follow this instantiation order when
- * writing the main .cpp / .ino file for the controller: Communication → Module(s) → Kernel. See the /examples folder
- * for details.
+ * When set to a non-zero value (for example, via the '-D AXMC_ENABLE_TIMER_EXECUTION=1' build flag), each module can
+ * designate a single command that runs from a hardware timer interrupt service routine when the PC queues it as a
+ * recurrent command. This is only supported on Teensy boards, which use the IntervalTimer (PIT) channels, and the
+ * Arduino Due, which uses the channels of the TC1 timer counter.
  *
- * @note Use the utility methods inherited from the base Module class and stage-based command design pattern to ensure
- * that the custom module implementation is compatible with non-blocking runtime mode. See the ReadMe for more
- * information about non-blocking runtime support.
+ * @warning On the Arduino Due, this mode defines the TC3_Handler(), TC4_Handler(), and TC5_Handler() interrupt
+ * handlers. Do not use this mode together with other libraries that use the TC1 timer counter, and only include this
+ * file in a single translation unit.
  */
-class Module
+#ifndef AXMC_ENABLE_TIMER_EXECUTION
+#define AXMC_ENABLE_TIMER_EXECUTION 0
+#endif
+
+/**
+ * @def AXMC_TIMER_EVENT_QUEUE_SIZE
+ * @brief Determines the number of events the timer-executed command of each module can buffer for transmission.
+ *
+ * Since the timer interrupt cannot send messages to the PC, the events it reports are buffered until the main loop
+ * sends them to the PC. A queue of this size is only reserved for each concurrently running timer-executed command.
+ */
+#ifndef AXMC_TIMER_EVENT_QUEUE_SIZE
+#define AXMC_TIMER_EVENT_QUEUE_SIZE 16
+#endif
+
+/**
+ * @def AXMC_SEQUENCE_STEP_COUNT
+ * @brief Determines the maximum number of steps in the command sequence program executed by the Kernel class.
+ *
+ * When set to a non-zero value (for example, via the '-D AXMC_SEQUENCE_STEP_COUNT=16' build flag), the PC can upload
+ * a command sequence program to the Kernel, which then queues the program's module commands locally, without PC
+ * round-trips. Each step reserves 12 bytes of RAM, and each module instance reserves 2 additional bytes to track the
+ * events awaited by the program. By default, the command sequence programs are not supported.
+ */
+#ifndef AXMC_SEQUENCE_STEP_COUNT
+#define AXMC_SEQUENCE_STEP_COUNT 0
+#endif
+
+/**
+ * @def AXMC_EVENT_LIMIT_COUNT
+ * @brief Determines the number of data events for which each Module instance can apply the PC-configured rate limits.
+ *
+ * When set to a non-zero value (for example, via the '-D AXMC_EVENT_LIMIT_COUNT=2' build flag), the PC can configure
+ * each module to decimate, rate-limit, and optionally average the data messages that communicate the specified custom
+ * events. This reduces the uplink load of the modules that sample at a high rate without changing the module code.
+ * Each limit slot reserves 32 bytes of RAM per module instance (28 bytes on AVR boards). By default, the event limits
+ * are not supported.
+ */
+#ifndef AXMC_EVENT_LIMIT_COUNT
+#define AXMC_EVENT_LIMIT_COUNT 0
+#endif
+
+#if AXMC_ENABLE_TIMER_EXECUTION
+#if defined(TEENSYDUINO)
+#include <IntervalTimer.h>
+#elif !defined(ARDUINO_ARCH_SAM)
+#error "The timer execution mode (AXMC_ENABLE_TIMER_EXECUTION) is only supported on Teensy and Arduino Due boards."
+#endif
+#endif
+
+/**
+ * @brief Accumulates the samples acquired by a hardware module into fixed-size blocks transmitted to the PC as single
+ * data messages.
+ *
+ * The class uses two sample buffers. While the samples are added to one buffer, the other buffer stores the last full
+ * block until it is sent to the PC via the Module::SendSampleBlock() method. Each block starts with a header that
+ * stores the block's sequence number and the acquisition time of the block's first sample, followed by the samples.
+ *
+ * @warning If both buffers are full when a new sample is added, the oldest unsent block is kept and the newly filled
+ * block is discarded. Since the sequence number is incremented for every filled block, the PC detects the discarded
+ * blocks as the gaps in the received sequence numbers.
+ *
+ * @note The AddSample() method is safe to call from an interrupt service routine, as long as the block transmission
+ * methods are called from the main loop.
+ *
+ * @tparam SampleType The type of the streamed samples.
+ * @tparam kBlockSize The number of samples in each block. The size of the transmitted block array, which includes
+ * the header elements, must be supported by the data message prototypes.
+ */
+template <typename SampleType, const size_t kBlockSize>
+class SampleStream
 {
+        static_assert(kBlockSize > 0, "The SampleStream block size must be at least 1.");
+
     public:
+        /// The number of block array elements used to store the block's sequence number and first sample timestamp.
+        static constexpr size_t kHeaderSize = (2 * sizeof(uint32_t) + sizeof(SampleType) - 1) / sizeof(SampleType);
+
+        /// The total number of elements in each transmitted block array.
+        static constexpr size_t kMessageSize = kHeaderSize + kBlockSize;
+
         /**
-         * @brief Stores the data that supports executing module-addressed commands sent from the PC interface.
+         * @brief Adds the input sample to the currently filled block.
          *
-         * @warning End users should not modify any elements of this structure directly. This structure is modified by
-         * the Kernel and certain utility methods inherited from the base Module class.
+         * @param sample The sample to add.
+         *
+         * @returns true if the sample was added, false if it completed a block that was discarded because the previous
+         * block has not been sent yet.
          */
-        struct ExecutionControlParameters
+        bool AddSample(const SampleType sample)
         {
-                uint8_t command          = 0;      ///< Currently executed (in-progress) command.
-                uint8_t stage            = 0;      ///< The stage of the currently executed command.
-                bool noblock             = false;  ///< Determines whether the current command is non-blocking.
-                uint8_t next_command     = 0;      ///< Stores the next command to be executed.
-                bool next_noblock        = false;  ///< Determines whether the next command is non-blocking.
-                bool new_command         = false;  ///< Determines whether next_command is a new or recurrent command.
-                bool run_recurrently     = false;  ///< Determines whether next_command is recurrent (cyclic).
-                uint32_t recurrent_delay = 0;      ///< The delay, in microseconds, between command repetitions.
-                elapsedMicros recurrent_timer;     ///< Measures recurrent command activation delays.
-                elapsedMicros delay_timer;         ///< Measures delays between command stages.
+            SampleType* block = _blocks[_active_block];
+
+            // Records the acquisition time of the block's first sample.
+            if (_sample_count == 0) _timestamp = micros();
+            block[kHeaderSize + _sample_count] = sample;
+            if (++_sample_count < kBlockSize) return true;
+
+            // Writes the header of the completed block.
+            const uint32_t header[2] = {_sequence_number++, _timestamp};  // NOLINT(*-avoid-c-arrays)
+            memcpy(block, header, sizeof(header));
+            _sample_count = 0;
+
+            // If the previous block was not sent yet, discards the completed block and refills the same buffer.
+            if (_ready_block >= 0)
+            {
+                _dropped_blocks = _dropped_blocks + 1;
+                return false;
+            }
+
+            // Otherwise, makes the completed block available for transmission and starts filling the other buffer.
+            __asm__ __volatile__("" ::: "memory");
+            _ready_block  = static_cast<int8_t>(_active_block);
+            _active_block = static_cast<uint8_t>(_active_block ^ 1);
+            return true;
+        }
+
+        /// Returns true if a full block is ready to be sent to the PC.
+        [[nodiscard]]
+        bool is_block_ready() const
+        {
+            return _ready_block >= 0;
+        }
+
+        /// Returns the last full block. Only valid if the is_block_ready() method returns true.
+        [[nodiscard]]
+        const SampleType (&get_ready_block() const)[kMessageSize]  // NOLINT(*-avoid-c-arrays)
+        {
+            return _blocks[_ready_block < 0 ? 0 : _ready_block];
+        }
+
+        /// Releases the buffer that stores the last full block so that it can be reused for acquiring new samples.
+        void ReleaseBlock()
+        {
+            __asm__ __volatile__("" ::: "memory");
+            _ready_block = -1;
+        }
+
+        /// Returns the number of blocks discarded since the stream was last reset.
+        [[nodiscard]]
+        uint32_t get_dropped_blocks() const
+        {
+            return _dropped_blocks;
+        }
+
+        /// Discards all buffered samples and resets the sequence number and the discarded block counter.
+        void Reset()
+        {
+            _ready_block     = -1;
+            _active_block    = 0;
+            _sample_count    = 0;
+            _sequence_number = 0;
+            _dropped_blocks  = 0;
+        }
+
+    private:
+        /// Stores the sample blocks.
+        SampleType _blocks[2][kMessageSize] = {};  // NOLINT(*-avoid-c-arrays)
+
+        /// Stores the index of the buffer that stores the full block ready to be sent or -1 if there is no such block.
+        volatile int8_t _ready_block = -1;
+
+        /// Stores the index of the buffer that is currently filled with samples.
+        uint8_t _active_block = 0;
+
+        /// Stores the number of samples in the currently filled block.
+        size_t _sample_count = 0;
+
+        /// Stores the acquisition time, in microseconds, of the currently filled block's first sample.
+        uint32_t _timestamp = 0;
+
+        /// Stores the sequence number of the next completed block.
+        uint32_t _sequence_number = 0;
+
+        /// Tracks the number of discarded blocks.
+        volatile uint32_t _dropped_blocks = 0;
+};
+
+/**
+ * @brief Passes the elements produced by an interrupt service routine to the main loop.
+ *
+ * The queue is a lock-free single-producer, single-consumer ring buffer: the Push() method is called from a single
+ * interrupt service routine and the Pop() method is called from the main loop. Both indices are single bytes, which are
+ * read and written atomically on AVR and ARM Cortex-M microcontrollers, so neither side needs to disable interrupts.
+ * Since these microcontrollers have a single core, compiler barriers are sufficient to order the element accesses
+ * relative to the index updates.
+ *
+ * @warning If the queue is full, the newly pushed elements are discarded and counted. Multiple interrupt service
+ * routines must not push elements into the same queue unless they cannot interrupt each other.
+ *
+ * @tparam ElementType The type of the buffered elements.
+ * @tparam kCapacity The maximum number of buffered elements. Must be between 1 and 254.
+ */
+template <typename ElementType, const uint8_t kCapacity>
+class InterruptSafeQueue
+{
+        static_assert(
+            kCapacity >= 1 && kCapacity <= 254, "The InterruptSafeQueue capacity has to be between 1 and 254."
+        );
+
+    public:
+        /**
+         * @brief Buffers the input element.
+         *
+         * @note Call this method from the interrupt service routine.
+         *
+         * @param element The element to buffer.
+         *
+         * @returns true if the element was buffered, false if it was discarded because the queue is full.
+         */
+        bool Push(const ElementType& element)
+        {
+            const uint8_t tail = _tail;
+            const uint8_t next = Advance(tail);
+            if (next == _head)
+            {
+                _dropped = _dropped + 1;
+                return false;
+            }
+
+            // Ensures that the element is written to the queue before it is made available to the main loop.
+            _elements[tail] = element;
+            CompilerBarrier();
+            _tail = next;
+            return true;
+        }
+
+        /**
+         * @brief Retrieves the oldest buffered element.
+         *
+         * @param element The object that receives the retrieved element.
+         *
+         * @returns true if an element was retrieved, false if the queue is empty.
+         */
+        bool Pop(ElementType& element)
+        {
+            const uint8_t head = _head;
+            if (head == _tail) return false;
+
+            // Ensures that the element is read only after observing the tail index that published it and that the slot
+            // is released only after the element is read.
+            CompilerBarrier();
+            element = _elements[head];
+            CompilerBarrier();
+            _head = Advance(head);
+            return true;
+        }
+
+        /// Returns the number of buffered elements.
+        [[nodiscard]]
+        uint8_t size() const
+        {
+            const uint8_t head = _head;
+            const uint8_t tail = _tail;
+            return static_cast<uint8_t>(tail >= head ? tail - head : tail + kSlotCount - head);
+        }
+
+        /// Returns the number of elements discarded since the last call to this method and resets the counter.
+        uint32_t TakeDropped()
+        {
+            // Avoids disabling interrupts if no elements were discarded.
+            if (_dropped == 0) return 0;
+
+            // Multi-byte counters cannot be read and reset atomically on AVR boards.
+            noInterrupts();
+            const uint32_t dropped = _dropped;
+            _dropped               = 0;
+            interrupts();
+            return dropped;
+        }
+
+        /// Discards all buffered elements and resets the discarded element counter.
+        void Reset()
+        {
+            noInterrupts();
+            _head    = _tail;
+            _dropped = 0;
+            interrupts();
+        }
+
+    private:
+        /// The number of element slots. One slot is always left empty to distinguish a full queue from an empty one.
+        static constexpr uint8_t kSlotCount = kCapacity + 1;
+
+        /// Returns the index that follows the input index. Avoids the division, which is slow on AVR boards.
+        static uint8_t Advance(const uint8_t index)
+        {
+            return index + 1 == kSlotCount ? 0 : static_cast<uint8_t>(index + 1);
+        }
+
+        /// Prevents the compiler from reordering the memory accesses across the call. Unlike the <atomic> fences, this
+        /// is supported by all boards, including AVR.
+        static void CompilerBarrier()
+        {
+            __asm__ __volatile__("" ::: "memory");
+        }
+
+        /// Stores the buffered elements.
+        ElementType _elements[kSlotCount];  // NOLINT(*-avoid-c-arrays)
+
+        /// Stores the index of the oldest buffered element. Only written by the main loop.
+        volatile uint8_t _head = 0;
+
+        /// Stores the index at which the next element is buffered. Only written by the interrupt.
+        volatile uint8_t _tail = 0;
+
+        /// Tracks the number of discarded elements.
+        volatile uint32_t _dropped = 0;
+};
+
+/// Stores an event pushed to the InterruptEventQueue by an interrupt service routine.
+struct InterruptEvent
+{
+        uint32_t timestamp = 0;  ///< The time, in microseconds, at which the event was pushed to the queue.
+        uint16_t value     = 0;  ///< The data value reported with the event.
+        uint8_t event_code = 0;  ///< The code of the reported event.
+};
+
+/**
+ * @brief Buffers the timestamped events reported by an interrupt service routine until they are sent to the PC by the
+ * main loop.
+ *
+ * The Push() method is called from a single interrupt service routine and the Pop() method is called from the main
+ * loop, typically via the Module::SendInterruptEvents() method. See the InterruptSafeQueue class for the details of the
+ * lock-free queue that stores the events.
+ *
+ * @warning If the queue is full, the newly pushed events are discarded and counted. Multiple interrupt service
+ * routines must not push events into the same queue unless they cannot interrupt each other.
+ *
+ * @tparam kCapacity The maximum number of buffered events. Must be between 1 and 254.
+ */
+template <const uint8_t kCapacity>
+class InterruptEventQueue
+{
+    public:
+        /**
+         * @brief Buffers the input event code and data value together with the current controller time.
+         *
+         * @note Call this method from the interrupt service routine.
+         *
+         * @param event_code The code of the reported event.
+         * @param value The data value to send along with the event code.
+         *
+         * @returns true if the event was buffered, false if it was discarded because the queue is full.
+         */
+        bool Push(const uint8_t event_code, const uint16_t value = 0)
+        {
+            return _events.Push({micros(), value, event_code});
+        }
+
+        /**
+         * @brief Retrieves the oldest buffered event.
+         *
+         * @param event The object that receives the retrieved event.
+         *
+         * @returns true if an event was retrieved, false if the queue is empty.
+         */
+        bool Pop(InterruptEvent& event)
+        {
+            return _events.Pop(event);
+        }
+
+        /// Returns the number of buffered events.
+        [[nodiscard]]
+        uint8_t size() const
+        {
+            return _events.size();
+        }
+
+        /// Returns the number of events discarded since the last call to this method and resets the counter.
+        uint32_t TakeDroppedEvents()
+        {
+            return _events.TakeDropped();
+        }
+
+        /// Discards all buffered events and resets the discarded event counter.
+        void Reset()
+        {
+            _events.Reset();
+        }
+
+    private:
+        /// Stores the buffered events.
+        InterruptSafeQueue<InterruptEvent, kCapacity> _events;
+};
+
+/**
+ * @brief Decides which of the sensor readouts reported via the Module::SendFilteredData() method are sent to the PC
+ * and how they are encoded.
+ *
+ * The filter supports three reporting modes. The kAlways mode sends every readout. The kDeadband mode only sends the
+ * readouts that differ from the last sent readout by more than the deadband. The kDelta mode also suppresses the
+ * readouts within the deadband, but sends the difference between the readout and the last sent readout as an int8 or
+ * int16 delta message whenever the difference fits into a type smaller than the readout type. The PC reconstructs the
+ * readouts by adding the deltas to the last received absolute readout (keyframe). In all modes, if the keyframe
+ * interval is not 0, the filter also sends the absolute readout once the specified number of readouts were reported
+ * since the last keyframe, even if the readout did not change.
+ *
+ * @note The reporting mode, the deadband, and the keyframe interval are typically part of the module's PC-addressable
+ * parameters and are applied via the Configure() method from the module's SetCustomParameters() method.
+ *
+ * @tparam ValueType The arithmetic type of the filtered readouts. The kDelta mode is only supported for integer types
+ * and sends the absolute readouts for the floating-point types.
+ */
+template <typename ValueType>
+class ReportingFilter
+{
+    public:
+        /// Defines the supported reporting modes.
+        enum class kReportingModes : uint8_t
+        {
+            kAlways   = 0,  ///< Sends every reported readout.
+            kDeadband = 1,  ///< Only sends the readouts that changed by more than the deadband.
+            kDelta    = 2,  ///< Sends the readouts outside the deadband as int8 or int16 deltas whenever possible.
+        };
+
+        /**
+         * @brief Initializes the filter that sends every reported readout.
+         *
+         * @param event_code The code of the event used to send the absolute readouts.
+         * @param delta_event_code The code of the event used to send the delta-encoded readouts in the kDelta mode.
+         */
+        ReportingFilter(const uint8_t event_code, const uint8_t delta_event_code) :
+            _event_code(event_code), _delta_event_code(delta_event_code)
+        {}
+
+        /**
+         * @brief Configures the reporting mode of the filter and forces the next reported readout to be sent as a
+         * keyframe.
+         *
+         * @param mode The code of the reporting mode. Codes that do not match any kReportingModes member select the
+         * kAlways mode.
+         * @param deadband The maximum difference between the reported and the last sent readout that does not trigger
+         * sending the reported readout. Must not be negative. Only used by the kDeadband and kDelta modes.
+         * @param keyframe_interval The number of reported readouts after which the filter sends the absolute readout
+         * regardless of its value. Setting this parameter to 0 disables periodic keyframes.
+         */
+        void Configure(const uint8_t mode, const ValueType deadband, const uint16_t keyframe_interval)
+        {
+            const bool supported = mode <= static_cast<uint8_t>(kReportingModes::kDelta);
+            _mode                = supported ? static_cast<kReportingModes>(mode) : kReportingModes::kAlways;
+            _deadband            = deadband;
+            _keyframe_interval   = keyframe_interval;
+            Reset();
+        }
+
+        /// Forces the next reported readout to be sent as a keyframe.
+        void Reset()
+        {
+            _has_keyframe = false;
+        }
+
+        /// Returns the code of the event used to send the absolute readouts.
+        [[nodiscard]]
+        uint8_t get_event_code() const
+        {
+            return _event_code;
+        }
+
+        /// Returns the code of the event used to send the delta-encoded readouts.
+        [[nodiscard]]
+        uint8_t get_delta_event_code() const
+        {
+            return _delta_event_code;
+        }
+
+    private:
+        friend class Module;
+
+        /// Defines the encodings of the readouts that pass through the filter.
+        enum class kEncodings : uint8_t
+        {
+            kSuppressed = 0,  ///< The readout is not sent.
+            kAbsolute   = 1,  ///< The readout is sent as is.
+            kInt8Delta  = 2,  ///< The difference from the last sent readout is sent as an int8 value.
+            kInt16Delta = 3,  ///< The difference from the last sent readout is sent as an int16 value.
+        };
+
+        /// Determines whether the filtered readouts use an integer type.
+        static constexpr bool kIsInteger = static_cast<ValueType>(1) / 2 == 0;
+
+        /**
+         * @brief Determines how to send the input readout and, unless the readout is suppressed, records it as the
+         * last sent readout.
+         *
+         * @param value The reported readout.
+         * @param delta The variable that receives the difference between the readout and the last sent readout, if
+         * the readout has to be sent as a delta.
+         *
+         * @returns The encoding of the readout.
+         */
+        kEncodings Filter(const ValueType value, int16_t& delta)
+        {
+            // Sends the absolute readout if this is the first readout since the reset, the filter does not filter the
+            // readouts, or the keyframe interval expired.
+            if (!_has_keyframe || _mode == kReportingModes::kAlways ||
+                (_keyframe_interval != 0 && ++_since_keyframe >= _keyframe_interval))
+            {
+                return RecordKeyframe(value);
+            }
+
+            const bool increased = value > _last_value;
+            if constexpr (kIsInteger)
+            {
+                // Computes the magnitude of the change using the unsigned 64-bit arithmetic, which cannot overflow for
+                // any supported integer type.
+                const uint64_t difference = increased
+                                                ? static_cast<uint64_t>(value) - static_cast<uint64_t>(_last_value)
+                                                : static_cast<uint64_t>(_last_value) - static_cast<uint64_t>(value);
+
+                // Suppresses the readouts within the deadband.
+                if (difference <= static_cast<uint64_t>(_deadband)) return kEncodings::kSuppressed;
+
+                // Encodes the change as a delta if the delta fits into a type smaller than the readout type.
+                if (_mode == kReportingModes::kDelta && sizeof(ValueType) > 1 && difference <= INT16_MAX)
+                {
+                    const auto magnitude = static_cast<int16_t>(difference);
+                    delta                = increased ? magnitude : static_cast<int16_t>(-magnitude);
+                    if (delta >= INT8_MIN && delta <= INT8_MAX)
+                    {
+                        _last_value = value;
+                        return kEncodings::kInt8Delta;
+                    }
+                    if (sizeof(ValueType) > 2)
+                    {
+                        _last_value = value;
+                        return kEncodings::kInt16Delta;
+                    }
+                }
+            }
+            else
+            {
+                // Suppresses the readouts within the deadband. Floating-point readouts cannot be exactly reconstructed
+                // from the deltas and are always sent as absolute readouts.
+                const ValueType difference = increased ? value - _last_value : _last_value - value;
+                if (!(difference > _deadband)) return kEncodings::kSuppressed;
+            }
+
+            _last_value = value;
+            return kEncodings::kAbsolute;
+        }
+
+        /// Records the input readout as the last sent keyframe.
+        kEncodings RecordKeyframe(const ValueType value)
+        {
+            _last_value     = value;
+            _has_keyframe   = true;
+            _since_keyframe = 0;
+            return kEncodings::kAbsolute;
+        }
+
+        /// Stores the code of the event used to send the absolute readouts.
+        const uint8_t _event_code;
+
+        /// Stores the code of the event used to send the delta-encoded readouts.
+        const uint8_t _delta_event_code;
+
+        /// Stores the reporting mode.
+        kReportingModes _mode = kReportingModes::kAlways;
+
+        /// Stores the deadband used by the kDeadband and kDelta modes.
+        ValueType _deadband = 0;
+
+        /// Stores the number of reported readouts after which the filter sends a keyframe. 0 disables keyframes.
+        uint16_t _keyframe_interval = 0;
+
+        /// Tracks the number of readouts reported since the last keyframe.
+        uint16_t _since_keyframe = 0;
+
+        /// Stores the last readout sent to the PC.
+        ValueType _last_value = 0;
+
+        /// Determines whether the filter has sent a keyframe since the last reset.
+        bool _has_keyframe = false;
+};
+
+/**
+ * @brief Provides the type-independent storage management for the double-buffered module parameters.
+ *
+ * @warning Do not use this class directly. Use the ParameterBuffer template class instead.
+ */
+class ParameterBufferBase
+{
+    public:
+        ParameterBufferBase(const ParameterBufferBase&)            = delete;
+        ParameterBufferBase& operator=(const ParameterBufferBase&) = delete;
+
+        /// Determines whether the buffer stores received parameters that are not yet used by the module.
+        [[nodiscard]]
+        bool has_pending_update() const
+        {
+            return _updated;
+        }
+
+    protected:
+        /**
+         * @brief Initializes the buffer that manages the specified parameter copies.
+         *
+         * @param active The pointer to the parameter copy used by the module's commands.
+         * @param pending The pointer to the parameter copy that receives the parameters sent by the PC.
+         * @param size The size of each parameter copy, in bytes.
+         */
+        ParameterBufferBase(void* active, const void* pending, const uint8_t size) :
+            _active(active), _pending(pending), _size(size)
+        {}
+
+        ~ParameterBufferBase() = default;
+
+        /// Determines whether the pending parameter copy stores the parameters that are not yet used by the module.
+        bool _updated = false;
+
+    private:
+        /// Allows the Module class to apply the received parameters at the command stage boundaries.
+        friend class Module;
+
+        /// If the buffer stores received parameters, copies them into the active parameter copy.
+        void Apply()
+        {
+            if (!_updated) return;
+            memcpy(_active, _pending, _size);
+            _updated = false;
+        }
+
+        /// Stores the pointer to the parameter copy used by the module's commands.
+        void* const _active;
+
+        /// Stores the pointer to the parameter copy that receives the parameters sent by the PC.
+        const void* const _pending;
+
+        /// Stores the size of each parameter copy, in bytes.
+        const uint8_t _size;
+};
+
+/**
+ * @brief Stores two copies of the module's PC-addressable parameters to ensure that the parameters received from the
+ * PC do not change while a command stage is running.
+ *
+ * The parameters received via the Module::ExtractParameters() method are written to the pending copy. The module
+ * copies them into the active copy, which is returned by the get() method, when there is no active command or when
+ * the active command transitions between stages. Since the transition happens after the stage returns, the
+ * parameters never change while a stage is running.
+ *
+ * @warning Each received parameter message is applied at the next stage transition. If the PC updates related
+ * parameters via multiple partial parameter messages, a stage transition between the messages publishes a partially
+ * updated set of parameters. Update the parameters that have to change together via a single message.
+ *
+ * @note Each module supports a single ParameterBuffer instance, which is registered with the module the first time it
+ * is passed to the Module::ExtractParameters() method.
+ *
+ * @warning Do not use the ParameterBuffer with the timer-executed commands, as their stage transitions may interrupt
+ * the parameter extraction.
+ *
+ * @tparam ParameterType The type of the module's parameters. Typically, this is a packed structure.
+ */
+template <typename ParameterType>
+class ParameterBuffer final : public ParameterBufferBase
+{
+        static_assert(
+            sizeof(ParameterType) > 0 && sizeof(ParameterType) <= Communication::get_maximum_parameters_size(),
+            "Unable to instantiate the ParameterBuffer class, as the ParameterType has an invalid size. A valid "
+            "parameter type must be at least 1 byte and fit into the received ModuleParameters message payload."
+        );
+
+    public:
+        /// Initializes the buffer with both parameter copies set to the input default parameters.
+        explicit ParameterBuffer(const ParameterType& defaults = ParameterType()) :
+            ParameterBufferBase(&_active, &_pending, sizeof(ParameterType)), _active(defaults), _pending(defaults)
+        {}
+
+        /// Returns the parameters used by the module's commands.
+        [[nodiscard]]
+        const ParameterType& get() const
+        {
+            return _active;
+        }
+
+        /// Returns the most recently received parameters, which may not yet be used by the module's commands.
+        [[nodiscard]]
+        const ParameterType& get_pending() const
+        {
+            return _pending;
+        }
+
+        /**
+         * @brief Overwrites both parameter copies with the input parameters and discards any pending update.
+         *
+         * @warning Calling this method while a command is running changes the parameters observed by the running
+         * command stage. Typically, this method is only called from the module's SetupModule() method.
+         *
+         * @param parameters The new parameters.
+         */
+        void Set(const ParameterType& parameters)
+        {
+            _active  = parameters;
+            _pending = parameters;
+            _updated = false;
+        }
+
+    private:
+        /// Allows the Module class to extract the received parameters into the pending parameter copy.
+        friend class Module;
+
+        /// Stores the parameters used by the module's commands.
+        ParameterType _active;
+
+        /// Stores the most recently received parameters.
+        ParameterType _pending;
+};
+
+/**
+ * @brief Provides the API used by other library components to integrate any custom hardware module class with
+ * the interface running on the companion host-computer (PC).
+ *
+ * Any class that inherits from this base class gains the API used by the Kernel and Communication classes to enable
+ * bidirectionally interfacing with the module via the interface running on the companion host-computer (PC)
+ *
+ * @warning Every custom module class @b has to inherit from this base class. Follow this instantiation order when
+ * writing the main .cpp / .ino file for the controller: Communication → Module(s) → Kernel. See the /examples folder
+ * for details.
+ *
+ * @note Use the utility methods inherited from the base Module class and stage-based command design pattern to ensure
+ * that the custom module implementation is compatible with non-blocking runtime mode. See the ReadMe for more
+ * information about non-blocking runtime support.
+ */
+class Module
+{
+    public:
+        /// Defines the number of one-off (non-recurrent) commands each Module instance can queue for execution.
+        static constexpr uint8_t kCommandQueueSize = AXMC_COMMAND_QUEUE_SIZE;
+
+        static_assert(
+            kCommandQueueSize > 0,
+            "The AXMC_COMMAND_QUEUE_SIZE has to be at least 1 to support queueing one-off commands."
+        );
+
+        /**
+         * @brief Stores the data that supports executing module-addressed commands sent from the PC interface.
+         *
+         * @warning End users should not modify any elements of this structure directly. This structure is modified by
+         * the Kernel and certain utility methods inherited from the base Module class.
+         */
+        struct ExecutionControlParameters
+        {
+                uint8_t command          = 0;      ///< Currently executed (in-progress) command.
+                uint8_t stage            = 0;      ///< The stage of the currently executed command.
+                bool noblock             = false;  ///< Determines whether the current command is non-blocking.
+                uint8_t next_command     = 0;      ///< Stores the recurrent command to be executed.
+                bool next_noblock        = false;  ///< Determines whether the recurrent command is non-blocking.
+                bool new_command         = false;  ///< Determines whether next_command is a newly queued command.
+                bool run_recurrently     = false;  ///< Determines whether next_command is recurrent (cyclic).
+                uint32_t recurrent_delay = 0;      ///< The delay, in microseconds, between command repetitions.
+                elapsedMicros recurrent_timer;     ///< Measures recurrent command activation delays.
+                elapsedMicros delay_timer;         ///< Measures delays between command stages.
+                uint8_t queued_commands[kCommandQueueSize] = {};  ///< The queued one-off commands.
+                bool queued_noblock[kCommandQueueSize]     = {};  ///< The noblock flags of the queued one-off commands.
+                uint8_t queue_head                         = 0;   ///< The index of the oldest queued one-off command.
+                uint8_t queue_size                         = 0;   ///< The number of queued one-off commands.
+#if AXMC_ENABLE_MESSAGE_TIMESTAMPS
+                bool queued_scheduled[kCommandQueueSize] = {};  ///< Determines whether the queued command is scheduled.
+                uint32_t queued_activation_times[kCommandQueueSize] = {};  ///< The scheduled command start times.
+#endif
+                mutable bool suspended                     = false;  ///< Determines whether the module awaits a delay.
+                mutable uint32_t wake_time                 = 0;  ///< The time, in microseconds, the delay expires.
+        };
+
+        /**
+         * @brief Defines the status codes used to communicate the states and errors encountered during the shared API
+         * method runtimes.
+         *
+         * @note To support consistent status code reporting, this enumeration reserves values 0 through 50. All custom
+         * status codes should use values 51 through 250. This prevents the status codes derived from this enumeration
+         * from clashing with custom status codes. Additionally, all custom event codes defined by each Module-derived
+         * class must be unique within that class to ensure unambiguous event identification by the PC.
+         *
+         * @attention This enumeration only covers status codes used by non-virtual methods inherited from the base
+         * Module class. These status codes are considered 'system-reserved' and are handled implicitly by the
+         * PC-side companion library.
+         */
+        enum class kCoreStatusCodes : uint8_t
+        {
+            kStandby                = 0,  ///< The code used to initialize the module_status variable.
+            kTransmissionError      = 1,  ///< Encountered an error when sending data to the PC.
+            kCommandCompleted       = 2,  ///< The last active command has been completed and removed from the queue.
+            kCommandNotRecognized   = 3,  ///< The RunActiveCommand() method did not recognize the requested command.
+            kCommandQueueFull       = 4,  ///< The multi-command queue is full and the queued command was discarded.
+            kTimerUnavailable       = 5,  ///< No hardware timer is available and the timed command runs from main loop.
+            kTimedEventsDropped     = 6,  ///< The timed command event queue overflowed and discarded events.
+            kInterruptEventsDropped = 7,  ///< The interrupt event queue overflowed and discarded events.
+        };
+
+        /**
+         * @brief Defines the execution priority classes used by the Kernel compiled with the priority scheduler to
+         * determine how often to run the instance's commands.
+         */
+        enum class kExecutionPriorities : uint8_t
+        {
+            kHigh   = 0,  ///< Runs every cycle and again after each lower-priority module executes a command.
+            kNormal = 1,  ///< Runs every cycle. This is the default priority of all modules.
+            kLow    = 2,  ///< Runs in a round-robin order, limited by the Kernel's low-priority time budget.
+        };
+
+        /**
+         * @brief Defines the communication channels used by the instance to send its data and state messages to the
+         * PC.
+         */
+        enum class kCommunicationChannels : uint8_t
+        {
+            kControl = 0,  ///< The primary Communication instance that also receives the PC-sent commands.
+            kData    = 1,  ///< The bulk-data Communication instance. Falls back to kControl if the Kernel has none.
+        };
+
+        /**
+         * @brief Initializes all shared assets used to integrate the module with the rest of the library components.
+         *
+         * @warning This initializer must be called as part of the custom module's initialization sequence for each
+         * module that subclasses this base class.
+         *
+         * @param module_type The code that identifies the type (family) of the module. All instances of the same
+         * custom module class should share this ID code.
+         * @param module_id The code that identifies the specific module instance. This code must be unique for
+         * each instance of the same module family (class) used as part of the same runtime.
+         * @param communication The shared Communication instance used to bidirectionally communicate with the PC
+         * during runtime.
+         */
+        Module(const uint8_t module_type, const uint8_t module_id, Communication& communication) :
+            _module_type(module_type), _module_id(module_id), _communication(communication)
+        {}
+
+        // These methods are used by the Kernel class to manage the runtime of the custom hardware module instances that
+        // inherit from this base class.
+
+        /**
+         * @brief Sets the bulk-data Communication instance used to send the messages routed to the kData channel.
+         *
+         * @note The Kernel constructed with a bulk-data Communication instance calls this method for all managed
+         * modules as part of its Setup() method.
+         *
+         * @param data_communication The Communication instance used to send the bulk-data messages to the PC.
+         */
+        void SetDataCommunication(Communication& data_communication)
+        {
+            _data_communication = &data_communication;
+        }
+
+        /**
+         * @brief Queues the input recurrent command to be executed by the Module during the next runtime cycle
+         * iteration.
+         *
+         * @warning If the module already has a recurrent command, this method replaces that command with the input
+         * command data. The recurrent command is activated after all queued one-off commands are executed.
+         *
+         * @param command The command to execute.
+         * @param noblock Determines whether the queued command should run in blocking or non-blocking mode.
+         * @param cycle_delay The delay, in microseconds, before repeating (cycling) the command.
+         */
+        void QueueCommand(const uint8_t command, const bool noblock, const uint32_t cycle_delay)
+        {
+#if AXMC_ENABLE_TIMER_EXECUTION
+            // Stops the timer-executed recurrent command, if any, as it is replaced by the input command.
+            StopTimedCommand();
+#endif
+
+            _execution_parameters.next_command    = command;
+            _execution_parameters.next_noblock    = noblock;
+            _execution_parameters.run_recurrently = true;
+            _execution_parameters.recurrent_delay = cycle_delay;
+            _execution_parameters.new_command     = true;
+        }
+
+        /**
+         * @brief Overloads the QueueCommand() method for queueing non-cyclic (one-off) commands.
+         *
+         * One-off commands are executed in the order they were queued. Queueing a one-off command cancels the
+         * module's recurrent command, if any.
+         *
+         * @note If the one-off command queue stores a single command (the default), the input command replaces the
+         * pending command, if any. Otherwise, if the queue is full, this method discards the input command and sends an
+         * error message to the PC.
+         *
+         * @returns true if the command was queued, false if the command queue is full.
+         */
+        bool QueueCommand(const uint8_t command, const bool noblock)
+        {
+            if (_execution_parameters.queue_size == kCommandQueueSize)
+            {
+                // The single-command queue keeps the most recently received command, so that the PC can replace the
+                // pending command without dequeueing it first.
+                if constexpr (kCommandQueueSize == 1)
+                {
+                    _execution_parameters.queue_size = 0;
+                }
+                else
+                {
+                    // Includes the discarded command code with the error message.
+                    SendData(static_cast<uint8_t>(kCoreStatusCodes::kCommandQueueFull), command);
+                    return false;
+                }
+            }
+
+            // Appends the command to the end of the queue.
+            const auto index = static_cast<uint8_t>(
+                (_execution_parameters.queue_head + _execution_parameters.queue_size) % kCommandQueueSize
+            );
+            _execution_parameters.queued_commands[index] = command;
+            _execution_parameters.queued_noblock[index]  = noblock;
+#if AXMC_ENABLE_MESSAGE_TIMESTAMPS
+            _execution_parameters.queued_scheduled[index] = false;
+#endif
+            _execution_parameters.queue_size++;
+
+            // Cancels the recurrent command, if any.
+            ResetRecurrentCommand();
+            return true;
+        }
+
+#if AXMC_ENABLE_MESSAGE_TIMESTAMPS
+        /**
+         * @brief Queues the input one-off command to be executed by the Module at the specified time.
+         *
+         * Scheduled commands share the queue with other one-off commands and are executed in the order they were
+         * queued. The module holds the scheduled command at the front of the queue until its activation time, so the
+         * commands queued after the scheduled command do not run before it. Commands whose activation time has already
+         * passed are executed as soon as they reach the front of the queue.
+         *
+         * @note Resolves the full command queue like the QueueCommand() method.
+         *
+         * @param command The command to execute.
+         * @param noblock Determines whether the queued command should run in blocking or non-blocking mode.
+         * @param activation_time The value of the micros() timer at which to start the command. Has to be less than
+         * 2^31 microseconds (~35 minutes) away from the current timer value.
+         *
+         * @returns true if the command was queued, false if the command queue is full.
+         */
+        bool ScheduleCommand(const uint8_t command, const bool noblock, const uint32_t activation_time)
+        {
+            if (!QueueCommand(command, noblock)) return false;
+
+            // Marks the command appended to the end of the queue as scheduled.
+            const auto index = static_cast<uint8_t>(
+                (_execution_parameters.queue_head + _execution_parameters.queue_size - 1) % kCommandQueueSize
+            );
+            _execution_parameters.queued_scheduled[index]        = true;
+            _execution_parameters.queued_activation_times[index] = activation_time;
+            return true;
+        }
+#endif
+
+        /**
+         * @brief Resets the module's command queue, including the recurrent command and all queued one-off commands.
+         *
+         * @note Calling this method does not abort already running commands: they are allowed to finish gracefully.
+         */
+        void ResetCommandQueue()
+        {
+            ResetRecurrentCommand();
+            _execution_parameters.queue_head = 0;
+            _execution_parameters.queue_size = 0;
+        }
+
+        /**
+         * @brief If possible, ensures that the module has an active command to execute.
+         *
+         * @note Uses the following order of preference to activate (execute) a command:
+         * finish already running commands > run queued one-off commands > run a newly queued recurrent command >
+         * repeat a previously executed recurrent command. Scheduled one-off commands are only activated once their
+         * activation delay expires.
+         * When repeating recurrent commands, the method ensures the recurrent timeout has expired before reactivating
+         * the command.
+         *
+         * @returns true if the module has a command to execute, false otherwise.
+         */
+        bool ResolveActiveCommand()
+        {
+            // Each resolution cycle starts with the module not awaiting any delays. The delay is re-registered if the
+            // module is still waiting for it to expire.
+            _execution_parameters.suspended = false;
+
+            // If the command field is not 0, this means there is already an active command being executed and no
+            // further action is necessary.
+            if (_execution_parameters.command != 0) return true;
+
+            // If there are queued one-off commands, activates the oldest queued command.
+            if (_execution_parameters.queue_size != 0)
+            {
+                const uint8_t index = _execution_parameters.queue_head;
+
+#if AXMC_ENABLE_MESSAGE_TIMESTAMPS
+                // If the oldest queued command is scheduled to start in the future, holds the command and registers
+                // the time at which it has to start.
+                if (_execution_parameters.queued_scheduled[index])
+                {
+                    const auto remaining =
+                        static_cast<int32_t>(_execution_parameters.queued_activation_times[index] - micros());
+                    if (remaining > 0)
+                    {
+                        SuspendUntil(static_cast<uint32_t>(remaining));
+                        return false;
+                    }
+                }
+#endif
+
+                _execution_parameters.command = _execution_parameters.queued_commands[index];
+                _execution_parameters.noblock = _execution_parameters.queued_noblock[index];
+                _execution_parameters.stage   = 1;
+
+                // Removes the activated command from the queue.
+                _execution_parameters.queue_head = static_cast<uint8_t>((index + 1) % kCommandQueueSize);
+                _execution_parameters.queue_size--;
+
+                return true;  // Returns true to indicate there is a command to run.
+            }
+
+            // If there is no active command and the next_command field is set to 0, this means that the module does
+            // not have any new or recurrent commands to execute.
+            if (_execution_parameters.next_command == 0) return false;
+
+            // If there is a next command in the queue and the new_command flag is set to true, activates the queued
+            // command without any further condition.
+            if (_execution_parameters.new_command)
+            {
+#if AXMC_ENABLE_TIMER_EXECUTION
+                // If the new command is the recurrent timer-executed command, starts the hardware timer that executes
+                // the command instead of activating it. If no timer is available, notifies the PC and executes the
+                // command from the main loop.
+                if (_execution_parameters.run_recurrently && _timed_command != 0 &&
+                    _execution_parameters.next_command == _timed_command)
+                {
+                    if (StartTimedCommand(_execution_parameters.recurrent_delay))
+                    {
+                        _execution_parameters.new_command = false;
+                        return false;
+                    }
+                    SendData(static_cast<uint8_t>(kCoreStatusCodes::kTimerUnavailable), _timed_command);
+                }
+#endif
+
+                // Transfers the command and the noblock flag from buffer fields to active fields
+                _execution_parameters.command = _execution_parameters.next_command;
+                _execution_parameters.noblock = _execution_parameters.next_noblock;
+
+                // Sets active command stage to 1, which is a secondary activation mechanism. All multi-stage commands
+                // should start with stage 1, as stage 0 is reserved for communicating no active commands sate.
+                _execution_parameters.stage = 1;
+
+                // Removes the new_command flag to indicate that the new command has been consumed.
+                _execution_parameters.new_command = false;
+
+                return true;  // Returns true to indicate there is a command to run.
+            }
+
+#if AXMC_ENABLE_TIMER_EXECUTION
+            // If the recurrent command is executed by the hardware timer, there is no command to activate.
+            if (_timer_slot >= 0) return false;
+#endif
+
+            // If no new command is available, recurrent activation is enabled, and the requested recurrent_delay
+            // number of microseconds has passed, re-activates the previously executed command. Note, the
+            // next_command != 0 check is here to support correct behavior in response to Dequeue command, which sets
+            // the next_command field to 0 and should be able to abort cyclic and non-cyclic command execution.
+            if (_execution_parameters.run_recurrently &&
+                _execution_parameters.recurrent_timer > _execution_parameters.recurrent_delay &&
+                _execution_parameters.next_command != 0)
+            {
+                // Repeats the activation steps from above, minus the new_command flag modification (command is not new)
+                _execution_parameters.command = _execution_parameters.next_command;
+                _execution_parameters.noblock = _execution_parameters.next_noblock;
+                _execution_parameters.stage   = 1;
+                return true;  // Indicates there is a command to run.
+            }
+
+            // The only way to reach this point is to have a recurrent command with an unexpired recurrent delay timer.
+            // Registers the time at which the recurrent delay expires and returns false to indicate that no command was
+            // activated.
+            const uint32_t elapsed = _execution_parameters.recurrent_timer;
+            if (_execution_parameters.run_recurrently && elapsed <= _execution_parameters.recurrent_delay)
+            {
+                SuspendUntil(_execution_parameters.recurrent_delay - elapsed + 1);
+            }
+            return false;
+        }
+
+        /**
+         * @brief Resets the module's command queue and aborts any currently running commands.
+         */
+        void ResetExecutionParameters()
+        {
+            // Resets the _execution_parameters structure back to default values
+            _execution_parameters.command         = 0;
+            _execution_parameters.stage           = 0;
+            _execution_parameters.noblock         = false;
+            _execution_parameters.next_command    = 0;
+            _execution_parameters.next_noblock    = false;
+            _execution_parameters.new_command     = false;
+            _execution_parameters.run_recurrently = false;
+            _execution_parameters.recurrent_delay = 0;
+            _execution_parameters.recurrent_timer = 0;
+            _execution_parameters.delay_timer     = 0;
+            _execution_parameters.queue_head      = 0;
+            _execution_parameters.queue_size      = 0;
+
+#if AXMC_ENABLE_TIMER_EXECUTION
+            StopTimedCommand();
+#endif
+        }
+
+#if AXMC_ENABLE_TIMER_EXECUTION
+        /**
+         * @brief Sends the events reported by the timer-executed command since the previous call to this method to the
+         * PC.
+         *
+         * @note If the timer-executed command reported more events than the event queue could buffer, this method also
+         * sends an error message that includes the number of discarded events to the PC.
+         */
+        void SendTimedEvents()
+        {
+            if (_timer_slot < 0) return;
+            TimerSlot& slot = GetTimerSlots()[_timer_slot];
+
+            // Empties the event queue filled by the timer interrupt.
+            TimerEvent event;
+            while (slot.events.Pop(event))
+            {
+                if (event.has_value) SendTimedData(event.event_code, event.value);
+                else SendTimedData(event.event_code);
+            }
+
+            const uint32_t dropped = slot.events.TakeDropped();
+            if (dropped > 0) SendTimedData(static_cast<uint8_t>(kCoreStatusCodes::kTimedEventsDropped), dropped);
+        }
+
+        /**
+         * @brief Executes the timer-executed command of the module that uses the specified hardware timer.
+         *
+         * @warning This method is called by the hardware timer interrupt handlers and should not be called directly.
+         *
+         * @param slot The index of the hardware timer that triggered the interrupt.
+         */
+        static void ServiceTimerInterrupt(const size_t slot)
+        {
+            Module* const module = GetTimerSlots()[slot].module;
+            if (module != nullptr) module->RunTimedCommand();
+        }
+#endif
+
+        /// Returns the ID of the instance.
+        [[nodiscard]]
+        uint8_t get_module_id() const
+        {
+            return _module_id;
+        }
+
+        /// Returns the type (family ID) of the instance.
+        [[nodiscard]]
+        uint8_t get_module_type() const
+        {
+            return _module_type;
+        }
+
+        /// Returns the combined type and id value of the instance.
+        [[nodiscard]]
+        uint16_t get_module_type_id() const
+        {
+            return _module_type_id;
+        }
+
+        /// Returns true if the module is waiting for a recurrent or stage delay to expire during the current runtime
+        /// cycle.
+        [[nodiscard]]
+        bool is_suspended() const
+        {
+            return _execution_parameters.suspended;
+        }
+
+        /// Returns the time, in microseconds, at which the delay awaited by the suspended module expires.
+        [[nodiscard]]
+        uint32_t get_wake_time() const
+        {
+            return _execution_parameters.wake_time;
+        }
+
+#if AXMC_SEQUENCE_STEP_COUNT > 0
+        /**
+         * @brief Starts tracking whether the module sends a message that communicates the input event code.
+         *
+         * @note Used by the Kernel to resolve the events awaited by the command sequence program steps.
+         *
+         * @param event_code The awaited event code. Set to 0 to stop tracking the events.
+         */
+        void AwaitEvent(const uint8_t event_code)
+        {
+            _awaited_event      = event_code;
+            _awaited_event_sent = false;
+        }
+
+        /// Returns true if the module has sent the event awaited via the AwaitEvent() method.
+        [[nodiscard]]
+        bool is_awaited_event_sent() const
+        {
+            return _awaited_event_sent;
+        }
+#endif
+
+#if AXMC_EVENT_LIMIT_COUNT > 0
+        /**
+         * @brief Configures the decimation, rate limit, and averaging applied to the data messages that communicate
+         * the event specified by the input settings.
+         *
+         * @note Used by the Kernel to apply the event limits received from the PC.
+         *
+         * @param settings The event limit settings received from the PC.
+         *
+         * @returns true if the settings were applied, false if the settings are invalid or all event limit slots are
+         * in use.
+         */
+        bool ConfigureEventLimit(const ModuleEventLimit& settings)
+        {
+            // Only custom event codes can be limited, as the PC relies on receiving every system-reserved event. The
+            // token bucket requires a non-zero refill interval, as it would otherwise never refill.
+            if (settings.event < 51 || settings.event > 250 || (settings.burst != 0 && settings.token_interval == 0))
+            {
+                return false;
+            }
+
+            EventLimitState* limit = FindEventLimit(settings.event);
+
+            // If the received settings do not limit the event, releases the slot used by the event.
+            if (settings.decimation <= 1 && settings.burst == 0)
+            {
+                if (limit != nullptr) *limit = EventLimitState();
+                return true;
+            }
+
+            // Otherwise, reuses the slot used by the event or claims a free slot.
+            if (limit == nullptr) limit = FindEventLimit(0);
+            if (limit == nullptr) return false;
+
+            *limit                = EventLimitState();
+            limit->event_code     = settings.event;
+            limit->decimation     = settings.decimation > 1 ? settings.decimation : 1;
+            limit->burst          = settings.burst;
+            limit->tokens         = settings.burst;
+            limit->token_interval = settings.token_interval;
+            limit->refill_time    = micros();
+            limit->average        = settings.average;
+            return true;
+        }
+
+        /// Removes all event limits configured for the instance.
+        void ResetEventLimits()
+        {
+            for (auto& limit : _event_limits) limit = EventLimitState();
+        }
+#endif
+
+        /// Returns true if the module's active command runs in the blocking mode and is waiting for a delay registered
+        /// by the YieldForMicros() method to expire. While this is true, the Kernel does not run other modules.
+        [[nodiscard]]
+        bool is_blocking_suspended() const
+        {
+            return _execution_parameters.command != 0 && !_execution_parameters.noblock &&
+                   _execution_parameters.suspended;
+        }
+
+        /// Returns the number of droppable messages the instance dropped since the counter was last reset.
+        [[nodiscard]]
+        uint32_t get_dropped_messages() const
+        {
+            return _dropped_messages;
+        }
+
+        /// Resets the dropped message counter of the instance.
+        void ResetDroppedMessages()
+        {
+            _dropped_messages = 0;
+        }
+
+        /// Returns true if the module has an active, queued, or recurrent command.
+        [[nodiscard]]
+        bool has_pending_commands() const
+        {
+            return _execution_parameters.command != 0 || _execution_parameters.queue_size != 0 ||
+                   _execution_parameters.next_command != 0;
+        }
+
+        /// Returns the execution priority class of the instance.
+        [[nodiscard]]
+        kExecutionPriorities get_execution_priority() const
+        {
+            return _execution_priority;
+        }
+
+        /**
+         * @brief Sets the execution priority class of the instance.
+         *
+         * @note The priority is only used by the Kernel compiled with the priority scheduler. It can be set at any
+         * time, for example, in the main .cpp / .ino file after instantiating the module.
+         *
+         * @param priority The execution priority class to use for the instance.
+         */
+        void set_execution_priority(const kExecutionPriorities priority)
+        {
+            _execution_priority = priority;
+        }
+
+        /**
+         * @brief Sends an error message to notify the PC that the instance did not recognize the active command.
+         */
+        void SendCommandActivationError() const
+        {
+            // Sends an error message that uses the unrecognized command code as 'command' and a 'not recognized' error
+            // code as the event.
+            SendData(static_cast<uint8_t>(kCoreStatusCodes::kCommandNotRecognized));
+        }
+
+        // These methods allow the Kernel class to interface with the custom logic of each custom hardware module
+        // instance, integrating them with the rest of the library components. The implementation of these methods
+        // relies on the end user as it has to be specific to each custom hardware module.
+
+        /**
+         * @brief Overwrites the memory of the object used to store the instance's runtime parameters with the data
+         * received from the PC.
+         *
+         * @note This method should call the ExtractParameters() method inherited from the base
+         * Module class to unpack the received custom parameters message into the structure (object) used to store the
+         * instance's custom runtime parameters.
+         *
+         * @returns true if new parameters were parsed successfully, false otherwise.
+         */
+        virtual bool SetCustomParameters() = 0;
+
+        /**
+         * @brief Executes the instance method associated with the active command.
+         *
+         * @warning This method should not evaluate whether the command ran successfully, only whether the command
+         * was recognized and matched to the appropriate method call. The called method should use the inherited
+         * SendData() method to report command runtime status to the PC.
+         *
+         * @note This method should translate the active command returned by the get_active_command()
+         * method inherited from the base Module class into the call to the command-specific method that executes the
+         * command's logic.
+         *
+         * @returns true if the active module command was matched to a specific custom method, false otherwise.
+         */
+        virtual bool RunActiveCommand() = 0;
+
+        /**
+         * @brief Sets up the instance's hardware and software assets.
+         *
+         * @note This method should set the initial (default) state of the instance's custom parameter structures and
+         * hardware (pins, timers, etc.).
+         *
+         * @attention Ideally, this method should not contain any logic that can fail or block, as this method is called
+         * as part of the initial library runtime setup procedure, before the communication interface is fully
+         * initialized.
+         *
+         * @returns true if the setup method ran successfully, false otherwise.
+         */
+        virtual bool SetupModule() = 0;
+
+        /**
+         * @brief Executes one iteration of the module's timer-executed command.
+         *
+         * This method is only called when the firmware is compiled with the AXMC_ENABLE_TIMER_EXECUTION build flag and
+         * the PC queues the command designated via the SetTimedCommand() method as a recurrent command. In this case,
+         * the method is called from the hardware timer interrupt once every recurrent command cycle delay.
+         *
+         * @warning This method runs inside the interrupt service routine. It must execute quickly, must not block, and
+         * must only use the BufferTimedEvent() method to report events to the PC.
+         */
+        virtual void RunTimedCommand() {}
+
+        /// Destroys the instance during cleanup.
+        virtual ~Module() = default;
+
+    protected:
+        // These methods are designed to help end users with writing custom module classes. They are not accessed by
+        // the Kernel class and are not required for integrating the custom module with the rest of the library. It is
+        // highly recommended to use these utility methods where appropriate, as they are required for the custom
+        // modules to support the full range of features provided by the library, such as non-blocking module command
+        // execution.
+
+        /// Returns the active (running) command's code or 0, if there are no active commands.
+        [[nodiscard]]
+        uint8_t get_active_command() const
+        {
+            return _execution_parameters.command;
+        }
+
+        /**
+         * @brief Terminates the active command (if any).
+         *
+         * If the aborted command is a recurrent command, the method resets the command queue to ensure that the
+         * command is not reactivated until it is re-queued from the PC.
+         */
+        void AbortCommand()
+        {
+            // Only resets the recurrent command if there is no other command to replace the currently executed command
+            // when it is completed. Queued one-off commands are not affected.
+            if (!_execution_parameters.new_command) ResetRecurrentCommand();
+            CompleteCommand();  // Finishes the command execution and sends the completion message to the PC.
+        }
+
+        /**
+         * @brief Advances the stage of the currently executed command.
+         *
+         * As part of its runtime, the method also resets the stage delay timer, making it a one-stop solution
+         * for properly transitioning between command stages.
+         */
+        void AdvanceCommandStage()
+        {
+            _execution_parameters.stage++;
+            _execution_parameters.delay_timer = 0;
+            ApplyPendingParameters();
+        }
+
+        /**
+         * @brief Sets the stage of the currently executed command to the input value.
+         *
+         * Similar to the AdvanceCommandStage() method, also resets the stage delay timer. This method is used by the
+         * command stage macros (AXMC_COMMAND_BEGIN and related macros) to record the point at which the command resumes
+         * its execution.
+         *
+         * @param stage The new stage of the command. Must not be 0, which is reserved for no active command.
+         */
+        void SetCommandStage(const uint8_t stage)
+        {
+            _execution_parameters.stage       = stage;
+            _execution_parameters.delay_timer = 0;
+            ApplyPendingParameters();
+        }
+
+        /**
+         * @brief Sets the communication channels used to send the instance's data and state messages to the PC.
+         *
+         * By default, the messages that include a data object are sent via the bulk-data channel, and the messages that
+         * only communicate an event code are sent via the control channel. This keeps high-rate data streams from
+         * delaying the time-sensitive state messages. If the Kernel does not use a bulk-data Communication instance,
+         * all messages are sent via the control channel.
+         *
+         * @warning The PC receives the messages sent via different channels in an unspecified relative order. Route
+         * both message classes to the same channel if the PC depends on their order.
+         *
+         * @note Call this method as part of the SetupModule() method.
+         *
+         * @param data_messages The channel used to send the messages that include a data object.
+         * @param state_messages The channel used to send the messages that only communicate an event code.
+         */
+        void SetMessageChannels(const kCommunicationChannels data_messages, const kCommunicationChannels state_messages)
+        {
+            _data_message_channel  = data_messages;
+            _state_message_channel = state_messages;
+        }
+
+        /// Returns the execution stage of the active (running) command or 0, if there are no active commands.
+        [[nodiscard]]
+        uint8_t get_command_stage() const
+        {
+            // If there is an actively executed command, returns its stage
+            if (_execution_parameters.command != 0) return _execution_parameters.stage;
+
+            // Otherwise returns 0 to indicate there is no actively running command
+            return 0;
+        }
+
+        /**
+         * @brief Completes (ends) the active (running) command's execution.
+         *
+         * @warning Only call this method when the command has completed everything it needed to do. To transition
+         * between the stages of the same command, use the AdvanceCommandStage() method instead.
+         *
+         * @note It is essential that this method is called at the end of every command's method (function) to allow
+         * executing other commands. Failure to do so can completely deadlock the Module and, in severe cases, the
+         * entire Microcontroller.
+         */
+        void CompleteCommand()
+        {
+            // Resolves and, if necessary, notifies the PC that the active command has been completed. This is only done
+            // for commands that have finished their runtime. Specifically, recurrent commands do not report completion
+            // until they are canceled or replaced by a new command. One-shot commands always report completion.
+            if (_execution_parameters.new_command || _execution_parameters.next_command == 0 ||
+                !_execution_parameters.run_recurrently)
+            {
+                // Since this automatically accesses _execution_parameters.command for command code, this has to be
+                // called before resetting the command field.
+                SendData(static_cast<uint8_t>(kCoreStatusCodes::kCommandCompleted));
+            }
+
+            _execution_parameters.command = 0;  // Removes active command code
+            _execution_parameters.stage   = 0;  // Secondary deactivation step, stage 0 is not a valid command stage
+            _execution_parameters.recurrent_timer =
+                0;  // Resets the recurrent command timer when the command is completed
+            _execution_parameters.suspended = false;  // Discards any delay awaited by the completed command
+            ApplyPendingParameters();  // Applies the parameters received while the command was running
+
+            // If the command that has just been completed is not a recurrent command and there is no new command,
+            // resets the recurrent command data to clear out the completed command data.
+            if (!_execution_parameters.new_command && !_execution_parameters.run_recurrently) ResetRecurrentCommand();
+        }
+
+        /**
+         * @brief Polls and (optionally) averages the value(s) of the specified analog pin.
+         *
+         * @param pin The analog pin to read.
+         * @param pool_size The number of pin readout values to average into the returned value. Set to 0 or 1 to
+         * disable averaging.
+         *
+         * @returns The read analog value.
+         */
+        [[nodiscard]]
+        static uint16_t AnalogRead(const uint8_t pin, const uint16_t pool_size = 0)
+        {
+            uint16_t average_readout;  // Pre-declares the final output readout
+
+            // Pool size 0 and 1 essentially mean the same: no averaging
+            if (pool_size < 2)
+            {
+                // If averaging is disabled, reads and outputs the acquired value.
+                average_readout = analogRead(pin);
+            }
+            else
+            {
+                uint32_t accumulated_readouts = 0;  // Aggregates polled values by self-addition
+
+                // If averaging is enabled, repeatedly polls the pin the requested number of times.
+                for (auto i = decltype(pool_size) {0}; i < pool_size; i++)
+                {
+                    accumulated_readouts += analogRead(pin);  // Aggregates readouts
+                }
+
+                // Averages and rounds the final readout to avoid dealing with floating point math. This favors Arduino
+                // boards without an FP module, Teensies technically can handle floating point arithmetic just as
+                // efficiently. Adding pool_size/2 before dividing by pool_size forces half-up ('standard') rounding.
+                average_readout = static_cast<uint16_t>((accumulated_readouts + pool_size / 2) / pool_size);
+            }
+
+            return average_readout;  // Returns the final averaged or raw readout
+        }
+
+        /**
+         * @brief Starts the asynchronous acquisition of the (optionally) averaged value of the specified analog pin.
+         *
+         * Unlike the AnalogRead() method, this method does not poll the pin. Instead, the readouts are acquired
+         * over multiple calls to the PollAnalogRead() method, which allows other modules to run their commands while
+         * the module averages a large number of readouts.
+         *
+         * @note Each module instance supports a single asynchronous acquisition at a time. Calling this method while
+         * an acquisition is in progress discards the acquired readouts and restarts the acquisition.
+         *
+         * @param pin The analog pin to read.
+         * @param pool_size The number of pin readout values to average into the acquired value. Set to 0 or 1 to
+         * disable averaging.
+         * @param samples_per_poll The maximum number of readouts acquired by each PollAnalogRead() method call.
+         */
+        void StartAnalogRead(const uint8_t pin, const uint16_t pool_size = 0, const uint16_t samples_per_poll = 1)
+        {
+            _analog_acquisition.pin                  = pin;
+            _analog_acquisition.pool_size            = pool_size < 2 ? 1 : pool_size;
+            _analog_acquisition.samples_per_poll     = samples_per_poll < 1 ? 1 : samples_per_poll;
+            _analog_acquisition.acquired_samples     = 0;
+            _analog_acquisition.accumulated_readouts = 0;
+            _analog_acquisition.readout              = 0;
+        }
+
+        /**
+         * @brief Acquires the next batch of readouts for the asynchronous analog acquisition started by the
+         * StartAnalogRead() method.
+         *
+         * @note Call this method once per command stage iteration until it returns true. Then, use the
+         * get_analog_readout() method to retrieve the acquired value.
+         *
+         * @returns true if the acquisition is complete, false if more readouts have to be acquired.
+         */
+        bool PollAnalogRead()
+        {
+            // If the acquisition is already complete, there is nothing to acquire.
+            if (_analog_acquisition.acquired_samples >= _analog_acquisition.pool_size) return true;
+
+            // Acquires up to the requested number of readouts per call.
+            for (uint16_t i = 0; i < _analog_acquisition.samples_per_poll &&
+                                 _analog_acquisition.acquired_samples < _analog_acquisition.pool_size;
+                 i++)
+            {
+                _analog_acquisition.accumulated_readouts += analogRead(_analog_acquisition.pin);
+                _analog_acquisition.acquired_samples++;
+            }
+
+            if (_analog_acquisition.acquired_samples < _analog_acquisition.pool_size) return false;
+
+            // Averages the readouts using the same half-up rounding as the AnalogRead() method.
+            _analog_acquisition.readout = static_cast<uint16_t>(
+                (_analog_acquisition.accumulated_readouts + _analog_acquisition.pool_size / 2) /
+                _analog_acquisition.pool_size
+            );
+            return true;
+        }
+
+        /// Returns the value acquired by the last completed asynchronous analog acquisition.
+        [[nodiscard]]
+        uint16_t get_analog_readout() const
+        {
+            return _analog_acquisition.readout;
+        }
+
+        /**
+         * @brief Polls and (optionally) averages the value(s) of the specified digital pin.
+         *
+         * @param pin The digital pin to read.
+         * @param pool_size The number of pin readout values to average into the returned value. Set to 0 or 1 to
+         * disable averaging.
+         *
+         * @returns The read digital value as true (HIGH) or false (LOW).
+         */
+        [[nodiscard]]
+        static bool DigitalRead(const uint8_t pin, const uint16_t pool_size = 0)
+        {
+            bool digital_readout;  // Pre-declares the final output readout
+
+            // Reads the physical sensor value.
+            if (pool_size < 2)
+            {
+                digital_readout = digitalReadFast(pin);
+            }
+            else
+            {
+                uint32_t accumulated_readouts = 0;  // Aggregates polled values by self-addition
+
+                // If averaging is enabled, repeatedly polls the pin the requested number of times. 'i' always uses
+                // the same type as pool_size.
+                for (auto i = decltype(pool_size) {0}; i < pool_size; i++)
+                {
+                    accumulated_readouts += digitalReadFast(pin);  // Aggregates readouts via self-addition
+                }
+
+                // Averages and rounds the final readout to avoid dealing with floating point math. This favors Arduino
+                // boards without an FP module, Teensies technically can handle floating point arithmetic just as
+                // efficiently. Adding pool_size/2 before dividing by pool_size forces half-up ('standard') rounding.
+                digital_readout = static_cast<bool>((accumulated_readouts + pool_size / 2) / pool_size);
+            }
+
+            return digital_readout;
+        }
+
+#if defined(__IMXRT1062__) || defined(__AVR__) || defined(ARDUINO_ARCH_SAM)
+        /// The type of the GPIO port input register read by the DigitalReadPort() method.
+#if defined(__AVR__)
+        using PortRegister = uint8_t;
+#else
+        using PortRegister = uint32_t;
+#endif
+
+        /**
+         * @brief Polls and (optionally) majority-votes the state of all pins of the GPIO port that includes the
+         * specified digital pin.
+         *
+         * Each readout samples the entire port input register in a single access, so all pins of the port are sampled
+         * at the same instant. The readouts of all pins are voted at the same time, using bit-parallel arithmetic.
+         *
+         * @note Use the GetPortMask() method to determine the bit of the returned value that stores the state of a
+         * specific pin.
+         *
+         * @param pin Any digital pin of the GPIO port to read.
+         * @param pool_size The number of port readout values to vote into the returned value. Set to 0 or 1 to
+         * disable voting. Each bit of the returned value is set if at least half of the readouts of that bit are set,
+         * which matches the rounding used by the DigitalRead() method.
+         *
+         * @returns The bitmask of the read port pin states, where each set bit corresponds to a HIGH pin.
+         */
+        [[nodiscard]]
+        static PortRegister DigitalReadPort(const uint8_t pin, const uint16_t pool_size = 0)
+        {
+#if defined(__IMXRT1062__)
+            const volatile uint32_t* port = portInputRegister(pin);
+#else
+            const volatile PortRegister* port = portInputRegister(digitalPinToPort(pin));
+#endif
+            return static_cast<PortRegister>(MajorityVote(pool_size, [port]() -> uint32_t { return *port; }));
+        }
+
+        /// Returns the bitmask that selects the bit of the DigitalReadPort() value storing the state of the specified
+        /// digital pin.
+        [[nodiscard]]
+        static PortRegister GetPortMask(const uint8_t pin)
+        {
+            return static_cast<PortRegister>(digitalPinToBitMask(pin));
+        }
+#endif
+
+        /**
+         * @brief Polls and (optionally) majority-votes the states of the specified digital pins.
+         *
+         * On Teensy 4.x, Arduino Due, and AVR boards, the method reads each GPIO port used by the input pins only once
+         * per readout, so all pins of the same port are sampled at the same instant. On other boards, the method reads
+         * each pin individually. In both cases, the readouts of all pins are voted at the same time, using
+         * bit-parallel arithmetic.
+         *
+         * @tparam kPinNumber The number of pins to read. Up to 32 pins are supported.
+         * @param pins The array of digital pins to read.
+         * @param pool_size The number of readout values to vote into the returned value. Set to 0 or 1 to disable
+         * voting. Each pin is considered HIGH if at least half of its readouts are HIGH, which matches the rounding
+         * used by the DigitalRead() method.
+         *
+         * @returns The bitmask of the read pin states, where bit N stores the state of the pin at index N of the input
+         * array.
+         */
+        template <const size_t kPinNumber>
+        [[nodiscard]]
+        static uint32_t DigitalReadPins(const uint8_t (&pins)[kPinNumber], const uint16_t pool_size = 0)
+        {
+            static_assert(kPinNumber > 0 && kPinNumber <= 32, "DigitalReadPins() supports reading 1 to 32 pins.");
+
+#if defined(__IMXRT1062__) || defined(__AVR__) || defined(ARDUINO_ARCH_SAM)
+            uint32_t result = 0;
+            uint32_t read   = 0;  // Tracks the pins whose port was already read.
+
+            for (size_t i = 0; i < kPinNumber; i++)
+            {
+                if (read & (1UL << i)) continue;
+
+                // Reads the port of the evaluated pin once and extracts the states of all input pins that use the same
+                // port.
+                const PortRegister port = DigitalReadPort(pins[i], pool_size);
+                for (size_t j = i; j < kPinNumber; j++)
+                {
+                    if (!IsSamePort(pins[i], pins[j])) continue;
+                    read |= 1UL << j;
+                    if (port & GetPortMask(pins[j])) result |= 1UL << j;
+                }
+            }
+            return result;
+#else
+            return MajorityVote(
+                pool_size,
+                [&pins]() -> uint32_t
+                {
+                    uint32_t readout = 0;
+                    for (size_t i = 0; i < kPinNumber; i++)
+                    {
+                        if (digitalReadFast(pins[i])) readout |= 1UL << i;
+                    }
+                    return readout;
+                }
+            );
+#endif
+        }
+
+        /**
+         * @brief Delays the active command execution for the requested number of microseconds.
+         *
+         * @warning The delay is timed relative to the last command's execution stage advancement.
+         *
+         * @note Depending on the active command's configuration, the method can block in-place until the
+         * delay has passed or function as a non-blocking check for whether the required duration of microseconds has
+         * passed. Use the YieldForMicros() method to also allow the Kernel compiled with the deadline scheduler to skip
+         * the module until the delay expires.
+         *
+         * @param delay_duration The delay duration, in microseconds.
+         */
+        [[nodiscard]]
+        bool WaitForMicros(const uint32_t delay_duration) const
+        {
+            // If the caller command is executed in blocking mode, blocks in-place until the requested duration has
+            // passed
+            if (!_execution_parameters.noblock)
+            {
+                // Blocks until delay_duration has passed
+                while (_execution_parameters.delay_timer <= delay_duration);
+            }
+
+            // Evaluates whether the requested number of microseconds has passed. If the duration was enforced above,
+            // this check will always be true.
+            if (_execution_parameters.delay_timer >= delay_duration)
+            {
+                return true;
+            }
+
+            // If the requested duration has not passed, returns false
+            return false;
+        }
+
+        /**
+         * @brief Checks whether the requested number of microseconds has passed since the last command's execution
+         * stage advancement without blocking.
+         *
+         * Unlike the WaitForMicros() method, this method never blocks, regardless of the active command's
+         * configuration. If the delay has not passed, it registers the delay expiration time, which allows the Kernel
+         * compiled with the deadline scheduler to skip the module until the delay expires. If the active command runs
+         * in the blocking mode, the Kernel does not run the commands of other modules until the delay expires, but
+         * keeps receiving and sending messages.
+         *
+         * @note This method is used by the AXMC_AWAIT_MICROS command stage macro.
+         *
+         * @param delay_duration The delay duration, in microseconds.
+         *
+         * @returns true if the delay has passed, false otherwise.
+         */
+        [[nodiscard]]
+        bool YieldForMicros(const uint32_t delay_duration) const
+        {
+            const uint32_t elapsed = _execution_parameters.delay_timer;
+            if (elapsed >= delay_duration) return true;
+            SuspendUntil(delay_duration - elapsed);
+            return false;
+        }
+
+        /**
+         * @brief Packages and sends the provided event_code and data object to the PC.
+         *
+         * The prototype code for the wire protocol is resolved automatically from the C++ type of the data object
+         * at compile time. Supports all 11 scalar types and C-style arrays at type-specific element counts up to
+         * the 248-byte payload cap. See the Supported SendData Types section of the README for the complete table
+         * of supported types and array sizes.
+         *
+         * @warning If sending the data fails for any reason, this method automatically emits an error message. Since
+         * that error message may itself fail to be sent, the method also statically activates the built-in LED of the
+         * board to visually communicate the encountered runtime error. Do not use the LED-connected pin or LED when
+         * using this method to avoid interference!
+         *
+         * @note If the message is intended to communicate only the event code, do not provide the data object.
+         * SendData() has an overloaded version specialized for sending event codes that is more efficient than the
+         * data-containing version.
+         *
+         * @tparam ObjectType The type of the data object to be sent along with the message.
+         * @param event_code The event that triggered the data transmission.
+         * @param object The data object to be sent along with the message.
+         *
+         * @returns true if the message was sent or suppressed by the PC-configured event limit, false if it could not
+         * be sent.
+         */
+        template <typename ObjectType>
+        bool SendData(const uint8_t event_code, const ObjectType& object)
+        {
+#if AXMC_SEQUENCE_STEP_COUNT > 0
+            RecordEvent(event_code);
+#endif
+
+#if AXMC_EVENT_LIMIT_COUNT > 0
+            // If the PC limits the event, the limit may suppress the message or replace the object with the mean of
+            // the suppressed samples.
+            EventLimitState* const limit = FindEventLimit(event_code);
+            if (limit != nullptr)
+            {
+                return ApplyEventLimit(
+                    *limit,
+                    object,
+                    [this, event_code](const auto& value) { return TransmitData(event_code, value); }
+                );
+            }
+#endif
+
+            return TransmitData(event_code, object);
+        }
+
+        /**
+         * @brief Packages and sends the provided event_code and data object to the PC as a droppable message.
+         *
+         * Unlike the SendData() method, this method never blocks. If the transmission path does not have enough free
+         * space to send the message without using the headroom reserved for the critical messages (see the
+         * AXMC_CRITICAL_MESSAGE_HEADROOM build flag), the message is dropped and the instance's dropped message counter
+         * is incremented without emitting an error message. If the message fits, but sending it fails, the method
+         * emits the error message like the SendData() method. Use this method to send high-rate telemetry that can
+         * tolerate losses during link saturation.
+         *
+         * @tparam ObjectType The type of the data object to be sent along with the message.
+         * @param event_code The event that triggered the data transmission.
+         * @param object The data object to be sent along with the message.
+         *
+         * @returns true if the message was sent or suppressed by the PC-configured event limit, false if it was
+         * dropped or could not be sent.
+         */
+        template <typename ObjectType>
+        bool SendDroppableData(const uint8_t event_code, const ObjectType& object)
+        {
+#if AXMC_SEQUENCE_STEP_COUNT > 0
+            RecordEvent(event_code);
+#endif
+
+#if AXMC_EVENT_LIMIT_COUNT > 0
+            EventLimitState* const limit = FindEventLimit(event_code);
+            if (limit != nullptr)
+            {
+                return ApplyEventLimit(
+                    *limit,
+                    object,
+                    [this, event_code](const auto& value) { return TransmitDroppableData(event_code, value); }
+                );
+            }
+#endif
+
+            return TransmitDroppableData(event_code, object);
+        }
+
+        /**
+         * @brief Packages the input data object into the prepared data message and sends it to the PC as a droppable
+         * message.
+         *
+         * @note See the SendDroppableData() method for details on the droppable messages.
+         *
+         * @tparam ObjectType The type of the data object sent with the message.
+         * @param message The data message prepared by the PrepareData() method.
+         * @param object The data object to be sent along with the message.
+         *
+         * @returns true if the message was sent or suppressed by the PC-configured event limit, false if it was
+         * dropped or could not be sent.
+         */
+        template <typename ObjectType>
+        bool SendDroppablePreparedData(
+            Communication::PreparedDataMessage<ObjectType>& message,
+            const ObjectType& object
+        )
+        {
+#if AXMC_SEQUENCE_STEP_COUNT > 0
+            RecordEvent(message.header.event);
+#endif
+
+#if AXMC_EVENT_LIMIT_COUNT > 0
+            EventLimitState* const limit = FindEventLimit(message.header.event);
+            if (limit != nullptr)
+            {
+                return ApplyEventLimit(
+                    *limit,
+                    object,
+                    [this, &message](const ObjectType& value) { return TransmitDroppablePreparedData(message, value); }
+                );
+            }
+#endif
+
+            return TransmitDroppablePreparedData(message, object);
+        }
+
+        /**
+         * @brief Constructs the prepared data message that communicates the input event code and a data object of the
+         * specified type.
+         *
+         * @note Prepared messages are intended for modules that send the same event many times per second. Store the
+         * returned message as a class member (for example, initialize it in the constructor) and send it via the
+         * SendPreparedData() method. This avoids constructing the message header for every sent message.
+         *
+         * @tparam ObjectType The type of the data object sent with the message.
+         * @param event_code The event communicated by the message.
+         *
+         * @returns The prepared message.
+         */
+        template <typename ObjectType>
+        [[nodiscard]]
+        Communication::PreparedDataMessage<ObjectType> PrepareData(const uint8_t event_code) const
+        {
+            return Communication::PrepareDataMessage<ObjectType>(_module_type, _module_id, event_code);
+        }
+
+        /**
+         * @brief Constructs the prepared state message that communicates the input event code.
+         *
+         * @note Send the returned message via the SendPreparedData() method.
+         *
+         * @param event_code The event communicated by the message.
+         *
+         * @returns The prepared message.
+         */
+        [[nodiscard]]
+        Communication::PreparedStateMessage PrepareState(const uint8_t event_code) const
+        {
+            return Communication::PrepareStateMessage(_module_type, _module_id, event_code);
+        }
+
+        /**
+         * @brief Packages the input data object into the prepared data message and sends it to the PC.
+         *
+         * @tparam ObjectType The type of the data object sent with the message.
+         * @param message The data message prepared by the PrepareData() method.
+         * @param object The data object to be sent along with the message.
+         */
+        template <typename ObjectType>
+        void SendPreparedData(Communication::PreparedDataMessage<ObjectType>& message, const ObjectType& object)
+        {
+#if AXMC_SEQUENCE_STEP_COUNT > 0
+            RecordEvent(message.header.event);
+#endif
+
+#if AXMC_EVENT_LIMIT_COUNT > 0
+            EventLimitState* const limit = FindEventLimit(message.header.event);
+            if (limit != nullptr)
+            {
+                ApplyEventLimit(
+                    *limit,
+                    object,
+                    [this, &message](const ObjectType& value)
+                    {
+                        TransmitPreparedData(message, value);
+                        return true;
+                    }
+                );
+                return;
+            }
+#endif
+
+            TransmitPreparedData(message, object);
+        }
+
+        /**
+         * @brief Overloads the SendPreparedData() method to send the prepared state messages.
+         *
+         * @param message The state message prepared by the PrepareState() method.
+         */
+        void SendPreparedData(Communication::PreparedStateMessage& message)
+        {
+#if AXMC_SEQUENCE_STEP_COUNT > 0
+            RecordEvent(message.event);
+#endif
+            Communication& channel = GetChannel(_state_message_channel);
+            if (channel.SendPreparedMessage(message, _execution_parameters.command)) return;
+            SendTransmissionError(channel, _execution_parameters.command);
+        }
+
+        /**
+         * @brief If the input sample stream has a full block of samples, sends the block to the PC as a single data
+         * message.
+         *
+         * @note Call this method once per command stage iteration while streaming samples. If sending the block fails,
+         * the block stays ready and is sent again by the next call to this method.
+         *
+         * @param event_code The code of the event that triggered the data transmission.
+         * @param stream The sample stream whose full block to send.
+         *
+         * @returns true if a block was sent, false if no full block is available or the block could not be sent.
+         */
+        template <typename SampleType, const size_t kBlockSize>
+        bool SendSampleBlock(const uint8_t event_code, SampleStream<SampleType, kBlockSize>& stream)
+        {
+            if (!stream.is_block_ready()) return false;
+            if (!SendData(event_code, stream.get_ready_block())) return false;
+            stream.ReleaseBlock();
+            return true;
+        }
+
+        /**
+         * @brief Reports the input sensor readout to the PC using the input reporting filter.
+         *
+         * Depending on the filter's reporting mode, the readout is sent as is, suppressed, or sent as an int8 or int16
+         * delta from the last sent readout using the filter's delta event code. See the ReportingFilter class for
+         * details.
+         *
+         * @tparam ValueType The type of the reported readout.
+         * @param filter The reporting filter of the readout.
+         * @param value The reported readout.
+         *
+         * @returns true if the readout was sent, false if it was suppressed.
+         */
+        template <typename ValueType>
+        bool SendFilteredData(ReportingFilter<ValueType>& filter, const ValueType value)
+        {
+            using kEncodings = typename ReportingFilter<ValueType>::kEncodings;
+
+            int16_t delta = 0;
+            switch (filter.Filter(value, delta))
+            {
+                case kEncodings::kAbsolute: SendData(filter.get_event_code(), value); return true;
+                case kEncodings::kInt8Delta:
+                    SendData(filter.get_delta_event_code(), static_cast<int8_t>(delta));
+                    return true;
+                case kEncodings::kInt16Delta: SendData(filter.get_delta_event_code(), delta); return true;
+                default: return false;
+            }
+        }
+
+        /**
+         * @brief Sends the events buffered by the input interrupt event queue to the PC.
+         *
+         * Each event is sent as a separate data message that communicates the event code and a two-element uint32
+         * array that stores the time, in microseconds, at which the event was pushed to the queue and the event's data
+         * value. If the Communication instance uses message batching, consecutive events are sent as a single
+         * batched message. If the queue discarded any events since the previous call, also sends the
+         * kInterruptEventsDropped message that communicates the number of discarded events.
+         *
+         * @note Call this method once per command stage iteration while capturing the events.
+         *
+         * @param queue The queue filled by the module's interrupt service routine.
+         * @param maximum_events The maximum number of events to send during this call. Limits the time spent sending
+         * the events if the interrupt fills the queue faster than the main loop drains it.
+         *
+         * @returns The number of sent events.
+         */
+        template <const uint8_t kCapacity>
+        uint8_t SendInterruptEvents(InterruptEventQueue<kCapacity>& queue, const uint8_t maximum_events = kCapacity)
+        {
+            uint8_t sent = 0;
+            InterruptEvent event;
+            while (sent < maximum_events && queue.Pop(event))
+            {
+                const uint32_t payload[2] = {event.timestamp, event.value};  // NOLINT(*-avoid-c-arrays)
+                SendData(event.event_code, payload);
+                sent++;
+            }
+
+            const uint32_t dropped = queue.TakeDroppedEvents();
+            if (dropped > 0) SendData(static_cast<uint8_t>(kCoreStatusCodes::kInterruptEventsDropped), dropped);
+            return sent;
+        }
+
+        /**
+         * @brief Packages and sends the provided event code to the PC.
+         *
+         * This method overloads the SendData() method to optimize transmitting messages that only need to communicate
+         * the event.
+         *
+         * @param event_code The code of the event that triggered the data transmission.
+         */
+        void SendData(const uint8_t event_code) const
+        {
+#if AXMC_SEQUENCE_STEP_COUNT > 0
+            RecordEvent(event_code);
+#endif
+
+            // Packages and sends the data to the connected system via the Communication class. If the message was
+            // sent, ends the runtime
+            Communication& channel = GetChannel(_state_message_channel);
+            if (channel.SendStateMessage(_module_type, _module_id, _execution_parameters.command, event_code)) return;
+
+            // If the message was not sent, calls a method that attempts to send a communication error message to the
+            // PC and turns on the built-in LED to visually indicate the error.
+            SendTransmissionError(channel, _execution_parameters.command);
+        }
+
+#if AXMC_ENABLE_TIMER_EXECUTION
+        /**
+         * @brief Designates the command executed from the hardware timer interrupt when it is queued as a recurrent
+         * command.
+         *
+         * @note Call this method as part of the SetupModule() method. When the PC queues the designated command as a
+         * recurrent command, the RunTimedCommand() method runs from the hardware timer interrupt once every command
+         * cycle delay. When queued as a one-off command, or if all hardware timers are busy, the command is executed by
+         * the RunActiveCommand() method, as usual.
+         *
+         * @param command The code of the timer-executed command. Set to 0 to disable the timer execution.
+         */
+        void SetTimedCommand(const uint8_t command)
+        {
+            _timed_command = command;
+        }
+
+        /**
+         * @brief Buffers the input event code and data value for transmission to the PC.
+         *
+         * @note This method is safe to call from the RunTimedCommand() method. Buffered events are sent to the PC by
+         * the main loop as data messages from the timer-executed command.
+         *
+         * @param event_code The code of the event that triggered the data transmission.
+         * @param value The data value to send along with the event code.
+         *
+         * @returns true if the event was buffered, false if the event queue is full.
+         */
+        bool BufferTimedEvent(const uint8_t event_code, const uint32_t value) const
+        {
+            return PushTimedEvent({event_code, true, value});
+        }
+
+        /**
+         * @brief Overloads the BufferTimedEvent() method to buffer events that do not include a data value.
+         *
+         * @param event_code The code of the event that triggered the data transmission.
+         *
+         * @returns true if the event was buffered, false if the event queue is full.
+         */
+        bool BufferTimedEvent(const uint8_t event_code) const
+        {
+            return PushTimedEvent({event_code, false, 0});
+        }
+#endif
+
+        /**
+         * @brief Unpacks the instance's runtime parameters received from the PC into the specified storage object.
+         *
+         * @tparam ObjectType The type of the object used to store the PC-addressable module's parameters.
+         * @param storage_object The object used to store the PC-addressable module's parameters.
+         *
+         * @returns true if the parameters were successfully unpacked, false otherwise.
+         */
+        template <typename ObjectType>
+        bool ExtractParameters(ObjectType& storage_object)
+        {
+            return _communication.ExtractModuleParameters(storage_object);
+        }
+
+        /**
+         * @brief Unpacks the instance's runtime parameters received from the PC into the pending copy of the
+         * specified parameter buffer.
+         *
+         * The received parameters are used by the module's commands once there is no active command or once the
+         * active command transitions between stages. The first call to this method registers the buffer with the
+         * instance.
+         *
+         * @tparam ParameterType The type of the PC-addressable module's parameters.
+         * @param buffer The double-buffered storage of the PC-addressable module's parameters.
+         *
+         * @returns true if the parameters were successfully unpacked, false otherwise.
+         */
+        template <typename ParameterType>
+        bool ExtractParameters(ParameterBuffer<ParameterType>& buffer)
+        {
+            _parameter_buffer = &buffer;
+            if (!_communication.ExtractModuleParameters(buffer._pending)) return false;
+            buffer._updated = true;
+
+            // If there is no active command, the parameters are applied immediately.
+            if (_execution_parameters.command == 0) buffer.Apply();
+            return true;
+        }
+
+    private:
+        /// Stores the instance's type (family) identifier code.
+        const uint8_t _module_type;
+
+        /// Stores the instance's unique identifier code.
+        const uint8_t _module_id;
+
+        /// Stores the instance's combined type and id uint16 code expected to be unique for each module instance
+        /// active at the same time.
+        const uint16_t _module_type_id = _module_type << 8 | _module_id;
+
+        /// Stores the instance's execution priority class.
+        kExecutionPriorities _execution_priority = kExecutionPriorities::kNormal;
+
+        /// Stores the Communication instance used to send module runtime data to the PC.
+        Communication& _communication;
+
+        /// Stores the Communication instance used to send the messages routed to the kData channel. Points to the
+        /// control Communication instance unless the Kernel provides a bulk-data Communication instance.
+        Communication* _data_communication = &_communication;
+
+        /// Stores the channel used to send the messages that include a data object.
+        kCommunicationChannels _data_message_channel = kCommunicationChannels::kData;
+
+        /// Stores the channel used to send the messages that only communicate an event code.
+        kCommunicationChannels _state_message_channel = kCommunicationChannels::kControl;
+
+        /// Tracks the number of droppable messages dropped due to the transmission backpressure.
+        uint32_t _dropped_messages = 0;
+
+        /// Stores the double-buffered PC-addressable parameters of the instance, if the instance uses them.
+        ParameterBufferBase* _parameter_buffer = nullptr;
+
+#if AXMC_EVENT_LIMIT_COUNT > 0
+        /// Stores the runtime state of the PC-configured limit of a single data event.
+        struct EventLimitState
+        {
+                int64_t integer_sum     = 0;      ///< The sum of the accumulated integer samples.
+                double floating_sum     = 0;      ///< The sum of the accumulated floating-point samples.
+                uint32_t sample_count   = 0;      ///< The number of accumulated samples.
+                uint32_t token_interval = 0;      ///< The time, in microseconds, it takes to refill a single token.
+                uint32_t refill_time    = 0;      ///< The time of the last token refill.
+                uint8_t event_code      = 0;      ///< The code of the limited event. 0 marks a free slot.
+                uint8_t decimation      = 1;      ///< Only every Nth event is considered for transmission.
+                uint8_t countdown       = 0;      ///< The number of events to suppress before the next decimated event.
+                uint8_t burst           = 0;      ///< The token bucket capacity. 0 disables the rate limit.
+                uint8_t tokens          = 0;      ///< The number of available tokens.
+                bool average            = false;  ///< Determines whether to send the mean of the suppressed samples.
         };
 
-        /**
-         * @brief Defines the status codes used to communicate the states and errors encountered during the shared API
-         * method runtimes.
-         *
-         * @note To support consistent status code reporting, this enumeration reserves values 0 through 50. All custom
-         * status codes should use values 51 through 250. This prevents the status codes derived from this enumeration
-         * from clashing with custom status codes. Additionally, all custom event codes defined by each Module-derived
-         * class must be unique within that class to ensure unambiguous event identification by the PC.
-         *
-         * @attention This enumeration only covers status codes used by non-virtual methods inherited from the base
-         * Module class. These status codes are considered 'system-reserved' and are handled implicitly by the
-         * PC-side companion library.
-         */
-        enum class kCoreStatusCodes : uint8_t
+        /// Stores the PC-configured limits of the instance's data events.
+        EventLimitState _event_limits[AXMC_EVENT_LIMIT_COUNT];  // NOLINT(*-avoid-c-arrays)
+#endif
+
+        /// Stores instance-specific runtime flow control parameters.
+        ExecutionControlParameters _execution_parameters;
+
+        /// Stores the state of the asynchronous analog pin acquisition.
+        struct AnalogAcquisition
         {
-            kStandby              = 0,  ///< The code used to initialize the module_status variable.
-            kTransmissionError    = 1,  ///< Encountered an error when sending data to the PC.
-            kCommandCompleted     = 2,  ///< The last active command has been completed and removed from the queue.
-            kCommandNotRecognized = 3,  ///< The RunActiveCommand() method did not recognize the requested command.
+                uint8_t pin                   = 0;  ///< The analog pin to read.
+                uint16_t pool_size            = 0;  ///< The number of readouts to average.
+                uint16_t samples_per_poll     = 1;  ///< The maximum number of readouts acquired per poll.
+                uint16_t acquired_samples     = 0;  ///< The number of already acquired readouts.
+                uint32_t accumulated_readouts = 0;  ///< The sum of the acquired readouts.
+                uint16_t readout              = 0;  ///< The averaged value of the last completed acquisition.
         };
 
+        /// Stores the asynchronous analog pin acquisition state.
+        AnalogAcquisition _analog_acquisition;
+
+#if AXMC_SEQUENCE_STEP_COUNT > 0
+        /// Stores the event code awaited by the Kernel's command sequence program or 0 if no event is awaited.
+        uint8_t _awaited_event = 0;
+
+        /// Determines whether the module has sent the awaited event since the event started being awaited.
+        mutable bool _awaited_event_sent = false;
+
+        /// Marks the awaited event as sent if the input event code matches the awaited event code.
+        void RecordEvent(const uint8_t event_code) const
+        {
+            if (_awaited_event != 0 && event_code == _awaited_event) _awaited_event_sent = true;
+        }
+#endif
+
         /**
-         * @brief Initializes all shared assets used to integrate the module with the rest of the library components.
+         * @brief Packages and sends the provided event_code and data object to the PC.
          *
-         * @warning This initializer must be called as part of the custom module's initialization sequence for each
-         * module that subclasses this base class.
+         * @note This method is used by the SendData() method after resolving the PC-configured event limits.
          *
-         * @param module_type The code that identifies the type (family) of the module. All instances of the same
-         * custom module class should share this ID code.
-         * @param module_id The code that identifies the specific module instance. This code must be unique for
-         * each instance of the same module family (class) used as part of the same runtime.
-         * @param communication The shared Communication instance used to bidirectionally communicate with the PC
-         * during runtime.
+         * @tparam ObjectType The type of the data object to be sent along with the message.
+         * @param event_code The event that triggered the data transmission.
+         * @param object The data object to be sent along with the message.
+         *
+         * @returns true if the message was sent, false otherwise.
          */
-        Module(const uint8_t module_type, const uint8_t module_id, Communication& communication) :
-            _module_type(module_type), _module_id(module_id), _communication(communication)
-        {}
+        template <typename ObjectType>
+        bool TransmitData(const uint8_t event_code, const ObjectType& object)
+        {
+            // Packages and sends the data to the connected system via the Communication class. If the message was sent,
+            // ends the runtime
+            Communication& channel = GetChannel(_data_message_channel);
+            if (channel.SendDataMessage(_module_type, _module_id, _execution_parameters.command, event_code, object))
+                return true;
 
-        // These methods are used by the Kernel class to manage the runtime of the custom hardware module instances that
-        // inherit from this base class.
+            // If the message was not sent, calls a method that attempts to send a communication error message to the
+            // PC and turns on the built-in LED to visually indicate the error.
+            SendTransmissionError(channel, _execution_parameters.command);
+            return false;
+        }
 
         /**
-         * @brief Queues the input command to be executed by the Module during the next runtime cycle iteration.
+         * @brief Packages and sends the provided event_code and data object to the PC as a droppable message.
          *
-         * @warning If the module already has a queued command, this method replaces that command with the input
-         * command data.
+         * @note This method is used by the SendDroppableData() method after resolving the PC-configured event limits.
          *
-         * @param command The command to execute.
-         * @param noblock Determines whether the queued command should run in blocking or non-blocking mode.
-         * @param cycle_delay The delay, in microseconds, before repeating (cycling) the command. Only provide this
-         * argument when queueing a recurrent command.
+         * @tparam ObjectType The type of the data object to be sent along with the message.
+         * @param event_code The event that triggered the data transmission.
+         * @param object The data object to be sent along with the message.
+         *
+         * @returns true if the message was sent, false if it was dropped or could not be sent.
          */
-        void QueueCommand(const uint8_t command, const bool noblock, const uint32_t cycle_delay)
+        template <typename ObjectType>
+        bool TransmitDroppableData(const uint8_t event_code, const ObjectType& object)
         {
-            _execution_parameters.next_command    = command;
-            _execution_parameters.next_noblock    = noblock;
-            _execution_parameters.run_recurrently = true;
-            _execution_parameters.recurrent_delay = cycle_delay;
-            _execution_parameters.new_command     = true;
-        }
+            // Only drops the message if the transmission path lacks the headroom. If the message fits, but sending it
+            // fails, reports the transmission error like the SendData() method.
+            Communication& channel = GetChannel(_data_message_channel);
+            if (!channel.HasTransmissionHeadroom(sizeof(Communication::ModuleDataHeader) + sizeof(ObjectType)))
+            {
+                RecordDroppedMessage();
+                return false;
+            }
 
-        /// Overloads the QueueCommand() method for queueing non-cyclic commands.
-        void QueueCommand(const uint8_t command, const bool noblock)
-        {
-            _execution_parameters.next_command    = command;
-            _execution_parameters.next_noblock    = noblock;
-            _execution_parameters.run_recurrently = false;
-            _execution_parameters.recurrent_delay = 0;
-            _execution_parameters.new_command     = true;
+            if (channel.SendDataMessage(_module_type, _module_id, _execution_parameters.command, event_code, object))
+                return true;
+            SendTransmissionError(channel, _execution_parameters.command);
+            return false;
         }
 
         /**
-         * @brief Resets the module's command queue.
+         * @brief Packages the input data object into the prepared data message and sends it to the PC.
          *
-         * @note Calling this method does not abort already running commands: they are allowed to finish gracefully.
+         * @note This method is used by the SendPreparedData() method after resolving the PC-configured event limits.
+         *
+         * @tparam ObjectType The type of the data object sent with the message.
+         * @param message The data message prepared by the PrepareData() method.
+         * @param object The data object to be sent along with the message.
          */
-        void ResetCommandQueue()
+        template <typename ObjectType>
+        void TransmitPreparedData(Communication::PreparedDataMessage<ObjectType>& message, const ObjectType& object)
         {
-            _execution_parameters.next_command    = 0;
-            _execution_parameters.next_noblock    = false;
-            _execution_parameters.run_recurrently = false;
-            _execution_parameters.recurrent_delay = 0;
-            _execution_parameters.new_command     = false;
+            memcpy(&message.object, &object, sizeof(ObjectType));
+            Communication& channel = GetChannel(_data_message_channel);
+            if (channel.SendPreparedMessage(message, _execution_parameters.command)) return;
+            SendTransmissionError(channel, _execution_parameters.command);
         }
 
         /**
-         * @brief If possible, ensures that the module has an active command to execute.
+         * @brief Packages the input data object into the prepared data message and sends it to the PC as a droppable
+         * message.
          *
-         * @note Uses the following order of preference to activate (execute) a command:
-         * finish already running commands > run new commands > repeat a previously executed recurrent command.
-         * When repeating recurrent commands, the method ensures the recurrent timeout has expired before reactivating
-         * the command.
+         * @note This method is used by the SendDroppablePreparedData() method after resolving the PC-configured event
+         * limits.
          *
-         * @returns true if the module has a command to execute, false otherwise.
+         * @tparam ObjectType The type of the data object sent with the message.
+         * @param message The data message prepared by the PrepareData() method.
+         * @param object The data object to be sent along with the message.
+         *
+         * @returns true if the message was sent, false if it was dropped or could not be sent.
          */
-        bool ResolveActiveCommand()
+        template <typename ObjectType>
+        bool TransmitDroppablePreparedData(
+            Communication::PreparedDataMessage<ObjectType>& message,
+            const ObjectType& object
+        )
         {
-            // If the command field is not 0, this means there is already an active command being executed and no
-            // further action is necessary.
-            if (_execution_parameters.command != 0) return true;
-
-            // If there is no active command and the next_command field is set to 0, this means that the module does
-            // not have any new or recurrent commands to execute.
-            if (_execution_parameters.next_command == 0) return false;
-
-            // If there is a next command in the queue and the new_command flag is set to true, activates the queued
-            // command without any further condition.
-            if (_execution_parameters.new_command)
-            {
-                // Transfers the command and the noblock flag from buffer fields to active fields
-                _execution_parameters.command = _execution_parameters.next_command;
-                _execution_parameters.noblock = _execution_parameters.next_noblock;
-
-                // Sets active command stage to 1, which is a secondary activation mechanism. All multi-stage commands
-                // should start with stage 1, as stage 0 is reserved for communicating no active commands sate.
-                _execution_parameters.stage = 1;
-
-                // Removes the new_command flag to indicate that the new command has been consumed.
-                _execution_parameters.new_command = false;
-
-                return true;  // Returns true to indicate there is a command to run.
-            }
-
-            // If no new command is available, recurrent activation is enabled, and the requested recurrent_delay
-            // number of microseconds has passed, re-activates the previously executed command. Note, the
-            // next_command != 0 check is here to support correct behavior in response to Dequeue command, which sets
-            // the next_command field to 0 and should be able to abort cyclic and non-cyclic command execution.
-            if (_execution_parameters.run_recurrently &&
-                _execution_parameters.recurrent_timer > _execution_parameters.recurrent_delay &&
-                _execution_parameters.next_command != 0)
+            // Only drops the message if the transmission path lacks the headroom. If the message fits, but sending it
+            // fails, reports the transmission error like the SendData() method.
+            Communication& channel = GetChannel(_data_message_channel);
+            if (!channel.HasTransmissionHeadroom(sizeof(message)))
             {
-                // Repeats the activation steps from above, minus the new_command flag modification (command is not new)
-                _execution_parameters.command = _execution_parameters.next_command;
-                _execution_parameters.noblock = _execution_parameters.next_noblock;
-                _execution_parameters.stage   = 1;
-                return true;  // Indicates there is a command to run.
+                RecordDroppedMessage();
+                return false;
             }
 
-            // The only way to reach this point is to have a recurrent command with an unexpired recurrent delay timer.
-            // Returns false to indicate that no command was activated.
+            memcpy(&message.object, &object, sizeof(ObjectType));
+            if (channel.SendPreparedMessage(message, _execution_parameters.command)) return true;
+            SendTransmissionError(channel, _execution_parameters.command);
             return false;
         }
 
-        /**
-         * @brief Resets the module's command queue and aborts any currently running commands.
-         */
-        void ResetExecutionParameters()
-        {
-            // Resets the _execution_parameters structure back to default values
-            _execution_parameters.command         = 0;
-            _execution_parameters.stage           = 0;
-            _execution_parameters.noblock         = false;
-            _execution_parameters.next_command    = 0;
-            _execution_parameters.next_noblock    = false;
-            _execution_parameters.new_command     = false;
-            _execution_parameters.run_recurrently = false;
-            _execution_parameters.recurrent_delay = 0;
-            _execution_parameters.recurrent_timer = 0;
-            _execution_parameters.delay_timer     = 0;
-        }
-
-        /// Returns the ID of the instance.
-        [[nodiscard]]
-        uint8_t get_module_id() const
+#if AXMC_EVENT_LIMIT_COUNT > 0
+        /// Returns the limit configured for the input event code or nullptr, if the event is not limited. Returns the
+        /// first free limit slot for the event code 0.
+        EventLimitState* FindEventLimit(const uint8_t event_code)
         {
-            return _module_id;
+            for (auto& limit : _event_limits)
+            {
+                if (limit.event_code == event_code) return &limit;
+            }
+            return nullptr;
         }
 
-        /// Returns the type (family ID) of the instance.
-        [[nodiscard]]
-        uint8_t get_module_type() const
+        /// Determines whether the data objects of the input type can be averaged. Only the integer scalars of up to 32
+        /// bits and the floating-point scalars are averaged.
+        template <typename ObjectType>
+        static constexpr bool IsAverageable()
         {
-            return _module_type;
+            if constexpr (is_array_v<ObjectType> || axtlmc_shared_assets::is_same_v<ObjectType, bool>) return false;
+            else return sizeof(ObjectType) <= 4 || IsFloatingPoint<ObjectType>();
         }
 
-        /// Returns the combined type and id value of the instance.
-        [[nodiscard]]
-        uint16_t get_module_type_id() const
+        /// Determines whether the input scalar type is a floating-point type.
+        template <typename ObjectType>
+        static constexpr bool IsFloatingPoint()
         {
-            return _module_type_id;
+            return static_cast<ObjectType>(1) / 2 != 0;
         }
 
         /**
-         * @brief Sends an error message to notify the PC that the instance did not recognize the active command.
+         * @brief Resolves the PC-configured limit of the data event and, unless the limit suppresses the event, sends
+         * the event's data to the PC via the input transmission function.
+         *
+         * @tparam ObjectType The type of the data object sent along with the message.
+         * @tparam TransmitFunction The type of the function that sends the data object to the PC.
+         * @param limit The limit configured for the event.
+         * @param object The data object to be sent along with the message.
+         * @param transmit The function that sends the data object (or the mean of the suppressed samples) to the PC.
+         *
+         * @returns true if the event was suppressed or its data was sent, false if the transmission function failed.
          */
-        void SendCommandActivationError() const
+        template <typename ObjectType, typename TransmitFunction>
+        static bool ApplyEventLimit(EventLimitState& limit, const ObjectType& object, TransmitFunction transmit)
         {
-            // Sends an error message that uses the unrecognized command code as 'command' and a 'not recognized' error
-            // code as the event.
-            SendData(static_cast<uint8_t>(kCoreStatusCodes::kCommandNotRecognized));
+            if constexpr (IsAverageable<ObjectType>())
+            {
+                if (limit.average)
+                {
+                    // Accumulates every sample, so that each sent mean covers all samples since the last sent event.
+                    if constexpr (IsFloatingPoint<ObjectType>()) limit.floating_sum += object;
+                    else limit.integer_sum += object;
+                    limit.sample_count++;
+
+                    if (!AdmitLimitedEvent(limit)) return true;
+                    return transmit(TakeAveragedSample<ObjectType>(limit));
+                }
+            }
+
+            if (!AdmitLimitedEvent(limit)) return true;
+            return transmit(object);
         }
 
-        // These methods allow the Kernel class to interface with the custom logic of each custom hardware module
-        // instance, integrating them with the rest of the library components. The implementation of these methods
-        // relies on the end user as it has to be specific to each custom hardware module.
+        /// Returns the mean of the samples accumulated by the input event limit and resets the accumulator. Rounds the
+        /// means of the integer samples to the nearest integer.
+        template <typename ObjectType>
+        static ObjectType TakeAveragedSample(EventLimitState& limit)
+        {
+            ObjectType mean;
+            if constexpr (IsFloatingPoint<ObjectType>())
+            {
+                mean = static_cast<ObjectType>(limit.floating_sum / limit.sample_count);
+            }
+            else
+            {
+                const auto count = static_cast<int64_t>(limit.sample_count);
+                const int64_t sum = limit.integer_sum;
+                mean = static_cast<ObjectType>(sum >= 0 ? (sum + count / 2) / count : (sum - count / 2) / count);
+            }
 
-        /**
-         * @brief Overwrites the memory of the object used to store the instance's runtime parameters with the data
-         * received from the PC.
-         *
-         * @note This method should call the ExtractParameters() method inherited from the base
-         * Module class to unpack the received custom parameters message into the structure (object) used to store the
-         * instance's custom runtime parameters.
-         *
-         * @returns true if new parameters were parsed successfully, false otherwise.
-         */
-        virtual bool SetCustomParameters() = 0;
+            limit.integer_sum  = 0;
+            limit.floating_sum = 0;
+            limit.sample_count = 0;
+            return mean;
+        }
 
         /**
-         * @brief Executes the instance method associated with the active command.
+         * @brief Determines whether the input event limit allows sending the current event.
          *
-         * @warning This method should not evaluate whether the command ran successfully, only whether the command
-         * was recognized and matched to the appropriate method call. The called method should use the inherited
-         * SendData() method to report command runtime status to the PC.
+         * The decimation is resolved first, so that the decimated events do not consume the token bucket's tokens.
          *
-         * @note This method should translate the active command returned by the get_active_command()
-         * method inherited from the base Module class into the call to the command-specific method that executes the
-         * command's logic.
+         * @param limit The limit configured for the event.
          *
-         * @returns true if the active module command was matched to a specific custom method, false otherwise.
+         * @returns true if the event has to be sent, false if it has to be suppressed.
          */
-        virtual bool RunActiveCommand() = 0;
+        static bool AdmitLimitedEvent(EventLimitState& limit)
+        {
+            if (limit.countdown != 0)
+            {
+                limit.countdown--;
+                return false;
+            }
+            limit.countdown = static_cast<uint8_t>(limit.decimation - 1);
 
-        /**
-         * @brief Sets up the instance's hardware and software assets.
-         *
-         * @note This method should set the initial (default) state of the instance's custom parameter structures and
-         * hardware (pins, timers, etc.).
-         *
-         * @attention Ideally, this method should not contain any logic that can fail or block, as this method is called
-         * as part of the initial library runtime setup procedure, before the communication interface is fully
-         * initialized.
-         *
-         * @returns true if the setup method ran successfully, false otherwise.
-         */
-        virtual bool SetupModule() = 0;
+            if (limit.burst == 0) return true;
 
-        /// Destroys the instance during cleanup.
-        virtual ~Module() = default;
+            // Refills the tokens accumulated since the last refill. Keeps the unused part of the refill interval
+            // unless the bucket is full.
+            const uint32_t now      = micros();
+            const uint32_t refilled = (now - limit.refill_time) / limit.token_interval;
+            if (refilled >= static_cast<uint32_t>(limit.burst - limit.tokens))
+            {
+                limit.tokens      = limit.burst;
+                limit.refill_time = now;
+            }
+            else if (refilled > 0)
+            {
+                limit.tokens       = static_cast<uint8_t>(limit.tokens + refilled);
+                limit.refill_time += refilled * limit.token_interval;
+            }
 
-    protected:
-        // These methods are designed to help end users with writing custom module classes. They are not accessed by
-        // the Kernel class and are not required for integrating the custom module with the rest of the library. It is
-        // highly recommended to use these utility methods where appropriate, as they are required for the custom
-        // modules to support the full range of features provided by the library, such as non-blocking module command
-        // execution.
+            if (limit.tokens == 0) return false;
+            limit.tokens--;
+            return true;
+        }
+#endif
 
-        /// Returns the active (running) command's code or 0, if there are no active commands.
-        [[nodiscard]]
-        uint8_t get_active_command() const
+        /// If the instance uses double-buffered parameters, applies the parameters received from the PC.
+        void ApplyPendingParameters() const
         {
-            return _execution_parameters.command;
+            if (_parameter_buffer != nullptr) _parameter_buffer->Apply();
         }
 
-        /**
-         * @brief Terminates the active command (if any).
-         *
-         * If the aborted command is a recurrent command, the method resets the command queue to ensure that the
-         * command is not reactivated until it is re-queued from the PC.
-         */
-        void AbortCommand()
+        /// Increments the dropped message counter without overflowing it.
+        void RecordDroppedMessage()
         {
-            // Only resets the command queue if there is no other command to replace the currently executed command when
-            // it is completed.
-            if (!_execution_parameters.new_command) ResetCommandQueue();
-            CompleteCommand();  // Finishes the command execution and sends the completion message to the PC.
+            if (_dropped_messages != UINT32_MAX) _dropped_messages++;
         }
 
         /**
-         * @brief Advances the stage of the currently executed command.
+         * @brief Sends the error message that communicates the failure to transmit a message via the input channel.
          *
-         * As part of its runtime, the method also resets the stage delay timer, making it a one-stop solution
-         * for properly transitioning between command stages.
+         * The error message is always sent via the control channel, but reports the statuses of the channel that
+         * failed to transmit the message.
+         *
+         * @param channel The Communication instance that failed to transmit the message.
+         * @param command The command executed by the module when it attempted to transmit the message.
          */
-        void AdvanceCommandStage()
+        void SendTransmissionError(const Communication& channel, const uint8_t command) const
         {
-            _execution_parameters.stage++;
-            _execution_parameters.delay_timer = 0;
+            _communication.SendCommunicationErrorMessage(
+                _module_type,
+                _module_id,
+                command,
+                static_cast<uint8_t>(kCoreStatusCodes::kTransmissionError),
+                channel
+            );
         }
 
-        /// Returns the execution stage of the active (running) command or 0, if there are no active commands.
+        /// Returns the Communication instance used to send the messages routed to the input channel.
         [[nodiscard]]
-        uint8_t get_command_stage() const
+        Communication& GetChannel(const kCommunicationChannels channel) const
         {
-            // If there is an actively executed command, returns its stage
-            if (_execution_parameters.command != 0) return _execution_parameters.stage;
-
-            // Otherwise returns 0 to indicate there is no actively running command
-            return 0;
+            return channel == kCommunicationChannels::kData ? *_data_communication : _communication;
         }
 
         /**
-         * @brief Completes (ends) the active (running) command's execution.
-         *
-         * @warning Only call this method when the command has completed everything it needed to do. To transition
-         * between the stages of the same command, use the AdvanceCommandStage() method instead.
+         * @brief Marks the module as waiting for a delay that expires after the specified number of microseconds.
          *
-         * @note It is essential that this method is called at the end of every command's method (function) to allow
-         * executing other commands. Failure to do so can completely deadlock the Module and, in severe cases, the
-         * entire Microcontroller.
+         * @param remaining_delay The time, in microseconds, until the awaited delay expires.
          */
-        void CompleteCommand()
+        void SuspendUntil(const uint32_t remaining_delay) const
         {
-            // Resolves and, if necessary, notifies the PC that the active command has been completed. This is only done
-            // for commands that have finished their runtime. Specifically, recurrent commands do not report completion
-            // until they are canceled or replaced by a new command. One-shot commands always report completion.
-            if (_execution_parameters.new_command || _execution_parameters.next_command == 0 ||
-                !_execution_parameters.run_recurrently)
-            {
-                // Since this automatically accesses _execution_parameters.command for command code, this has to be
-                // called before resetting the command field.
-                SendData(static_cast<uint8_t>(kCoreStatusCodes::kCommandCompleted));
-            }
-
-            _execution_parameters.command = 0;  // Removes active command code
-            _execution_parameters.stage   = 0;  // Secondary deactivation step, stage 0 is not a valid command stage
-            _execution_parameters.recurrent_timer =
-                0;  // Resets the recurrent command timer when the command is completed
-
-            // If the command that has just been completed is not a recurrent command and there is no new command,
-            // resets the command queue to clear out the completed command data.
-            if (!_execution_parameters.new_command && !_execution_parameters.run_recurrently) ResetCommandQueue();
+            _execution_parameters.suspended = true;
+            _execution_parameters.wake_time = micros() + remaining_delay;
         }
 
         /**
-         * @brief Polls and (optionally) averages the value(s) of the specified analog pin.
+         * @brief Acquires the requested number of 32-bit readouts from the input sampler and majority-votes each bit
+         * of the readouts at the same time, using bit-parallel arithmetic.
          *
-         * @param pin The analog pin to read.
-         * @param pool_size The number of pin readout values to average into the returned value. Set to 0 or 1 to
-         * disable averaging.
+         * @param pool_size The number of readouts to vote. Set to 0 or 1 to return a single readout.
+         * @param sample The callable that acquires and returns a single readout.
          *
-         * @returns The read analog value.
+         * @returns The value where each bit is set if at least half of the readouts of that bit are set.
          */
-        [[nodiscard]]
-        static uint16_t AnalogRead(const uint8_t pin, const uint16_t pool_size = 0)
+        template <typename Sampler>
+        static uint32_t MajorityVote(const uint16_t pool_size, Sampler sample)
         {
-            uint16_t average_readout;  // Pre-declares the final output readout
+            if (pool_size < 2) return sample();
 
-            // Pool size 0 and 1 essentially mean the same: no averaging
-            if (pool_size < 2)
+            // Counts the set readouts of each bit using a vertical counter: plane K stores bit K of all 32 counters.
+            constexpr size_t kPlaneCount = 16;
+            uint32_t planes[kPlaneCount] = {};  // NOLINT(*-avoid-c-arrays)
+            for (auto i = decltype(pool_size) {0}; i < pool_size; i++)
             {
-                // If averaging is disabled, reads and outputs the acquired value.
-                average_readout = analogRead(pin);
+                uint32_t carry = sample();
+                for (size_t plane = 0; plane < kPlaneCount && carry != 0; plane++)
+                {
+                    const uint32_t sum = planes[plane] ^ carry;
+                    carry              = planes[plane] & carry;
+                    planes[plane]      = sum;
+                }
             }
-            else
-            {
-                uint32_t accumulated_readouts = 0;  // Aggregates polled values by self-addition
 
-                // If averaging is enabled, repeatedly polls the pin the requested number of times.
-                for (auto i = decltype(pool_size) {0}; i < pool_size; i++)
+            // Compares all counters to the voting threshold, starting from the most significant plane. The threshold
+            // matches the half-up rounding used by the DigitalRead() method.
+            const auto threshold = static_cast<uint16_t>(pool_size - pool_size / 2);
+            uint32_t greater     = 0;
+            uint32_t equal       = UINT32_MAX;
+            for (size_t plane = kPlaneCount; plane-- > 0;)
+            {
+                if (threshold & (1U << plane)) equal &= planes[plane];
+                else
                 {
-                    accumulated_readouts += analogRead(pin);  // Aggregates readouts
+                    greater |= equal & planes[plane];
+                    equal &= ~planes[plane];
                 }
-
-                // Averages and rounds the final readout to avoid dealing with floating point math. This favors Arduino
-                // boards without an FP module, Teensies technically can handle floating point arithmetic just as
-                // efficiently. Adding pool_size/2 before dividing by pool_size forces half-up ('standard') rounding.
-                average_readout = static_cast<uint16_t>((accumulated_readouts + pool_size / 2) / pool_size);
             }
+            return greater | equal;
+        }
 
-            return average_readout;  // Returns the final averaged or raw readout
+#if defined(__IMXRT1062__) || defined(__AVR__) || defined(ARDUINO_ARCH_SAM)
+        /// Returns true if both input digital pins belong to the same GPIO port.
+        static bool IsSamePort(const uint8_t first, const uint8_t second)
+        {
+#if defined(__IMXRT1062__)
+            return portInputRegister(first) == portInputRegister(second);
+#else
+            return digitalPinToPort(first) == digitalPinToPort(second);
+#endif
         }
+#endif
 
-        /**
-         * @brief Polls and (optionally) averages the value(s) of the specified digital pin.
-         *
-         * @param pin The digital pin to read.
-         * @param pool_size The number of pin readout values to average into the returned value. Set to 0 or 1 to
-         * disable averaging.
-         *
-         * @returns The read digital value as true (HIGH) or false (LOW).
-         */
-        [[nodiscard]]
-        static bool DigitalRead(const uint8_t pin, const uint16_t pool_size = 0)
+        /// Clears the module's recurrent command data without affecting the queued one-off commands.
+        void ResetRecurrentCommand()
         {
-            bool digital_readout;  // Pre-declares the final output readout
+            _execution_parameters.next_command    = 0;
+            _execution_parameters.next_noblock    = false;
+            _execution_parameters.run_recurrently = false;
+            _execution_parameters.recurrent_delay = 0;
+            _execution_parameters.new_command     = false;
 
-            // Reads the physical sensor value.
-            if (pool_size < 2)
-            {
-                digital_readout = digitalReadFast(pin);
-            }
-            else
-            {
-                uint32_t accumulated_readouts = 0;  // Aggregates polled values by self-addition
+#if AXMC_ENABLE_TIMER_EXECUTION
+            StopTimedCommand();
+#endif
+        }
 
-                // If averaging is enabled, repeatedly polls the pin the requested number of times. 'i' always uses
-                // the same type as pool_size.
-                for (auto i = decltype(pool_size) {0}; i < pool_size; i++)
-                {
-                    accumulated_readouts += digitalReadFast(pin);  // Aggregates readouts via self-addition
-                }
+#if AXMC_ENABLE_TIMER_EXECUTION
+        static_assert(
+            AXMC_TIMER_EVENT_QUEUE_SIZE > 0 && AXMC_TIMER_EVENT_QUEUE_SIZE < 255,
+            "The AXMC_TIMER_EVENT_QUEUE_SIZE has to be between 1 and 254."
+        );
 
-                // Averages and rounds the final readout to avoid dealing with floating point math. This favors Arduino
-                // boards without an FP module, Teensies technically can handle floating point arithmetic just as
-                // efficiently. Adding pool_size/2 before dividing by pool_size forces half-up ('standard') rounding.
-                digital_readout = static_cast<bool>((accumulated_readouts + pool_size / 2) / pool_size);
-            }
+#if defined(TEENSYDUINO)
+        /// The number of hardware timers available for executing timed commands. Teensy boards have 4 PIT channels.
+        static constexpr size_t kTimerSlotCount = 4;
+#else
+        /// The number of hardware timers available for executing timed commands. Arduino Due uses the 3 channels of
+        /// the TC1 timer counter.
+        static constexpr size_t kTimerSlotCount = 3;
+#endif
 
-            return digital_readout;
+        /// Stores an event reported by the timer-executed command.
+        struct TimerEvent
+        {
+                uint8_t event_code = 0;      ///< The code of the reported event.
+                bool has_value     = false;  ///< Determines whether the event includes a data value.
+                uint32_t value     = 0;      ///< The data value reported with the event.
+        };
+
+        /// Stores the state of a hardware timer used to execute timed commands.
+        struct TimerSlot
+        {
+                Module* volatile module = nullptr;  ///< The module whose timed command is executed by the timer.
+
+                /// The queue of events reported from the timer interrupt.
+                InterruptSafeQueue<TimerEvent, AXMC_TIMER_EVENT_QUEUE_SIZE> events;
+#if defined(TEENSYDUINO)
+                IntervalTimer timer;  ///< The PIT channel used to execute the timed command.
+#endif
+        };
+
+        /// Stores the code of the command executed from the hardware timer interrupt.
+        uint8_t _timed_command = 0;
+
+        /// Stores the index of the hardware timer that executes the module's timed command or -1 if the command is not
+        /// running.
+        int8_t _timer_slot = -1;
+
+        /// Returns the pointer to the shared array of hardware timer states.
+        static TimerSlot* GetTimerSlots()
+        {
+            static TimerSlot slots[kTimerSlotCount];  // NOLINT(*-avoid-c-arrays)
+            return slots;
+        }
+
+        /// Calls the ServiceTimerInterrupt() method for the specified hardware timer. Used as the interrupt callback.
+        template <const size_t kSlot>
+        static void HandleTimerInterrupt()
+        {
+            ServiceTimerInterrupt(kSlot);
+        }
+
+        /// Buffers the input event in the event queue of the timer-executed command.
+        bool PushTimedEvent(const TimerEvent& event) const
+        {
+            if (_timer_slot < 0) return false;
+            return GetTimerSlots()[_timer_slot].events.Push(event);
         }
 
         /**
-         * @brief Delays the active command execution for the requested number of microseconds.
-         *
-         * @warning The delay is timed relative to the last command's execution stage advancement.
-         *
-         * @note Depending on the active command's configuration, the method can block in-place until the
-         * delay has passed or function as a non-blocking check for whether the required duration of microseconds has
-         * passed.
+         * @brief Packages and sends the input event code and data value reported by the timer-executed command to the
+         * PC.
          *
-         * @param delay_duration The delay duration, in microseconds.
+         * @note Like the SendData() method, applies the PC-configured limit of the event before sending the data.
          */
-        [[nodiscard]]
-        bool WaitForMicros(const uint32_t delay_duration) const
+        void SendTimedData(const uint8_t event_code, const uint32_t value)
         {
-            // If the caller command is executed in blocking mode, blocks in-place until the requested duration has
-            // passed
-            if (!_execution_parameters.noblock)
-            {
-                // Blocks until delay_duration has passed
-                while (_execution_parameters.delay_timer <= delay_duration);
-            }
+#if AXMC_SEQUENCE_STEP_COUNT > 0
+            RecordEvent(event_code);
+#endif
 
-            // Evaluates whether the requested number of microseconds has passed. If the duration was enforced above,
-            // this check will always be true.
-            if (_execution_parameters.delay_timer >= delay_duration)
+#if AXMC_EVENT_LIMIT_COUNT > 0
+            EventLimitState* const limit = FindEventLimit(event_code);
+            if (limit != nullptr)
             {
-                return true;
+                ApplyEventLimit(
+                    *limit,
+                    value,
+                    [this, event_code](const uint32_t sample)
+                    {
+                        TransmitTimedData(event_code, sample);
+                        return true;
+                    }
+                );
+                return;
             }
+#endif
 
-            // If the requested duration has not passed, returns false
-            return false;
+            TransmitTimedData(event_code, value);
         }
 
-        /**
-         * @brief Packages and sends the provided event_code and data object to the PC.
-         *
-         * The prototype code for the wire protocol is resolved automatically from the C++ type of the data object
-         * at compile time. Supports all 11 scalar types and C-style arrays at type-specific element counts up to
-         * the 248-byte payload cap. See the Supported SendData Types section of the README for the complete table
-         * of supported types and array sizes.
-         *
-         * @warning If sending the data fails for any reason, this method automatically emits an error message. Since
-         * that error message may itself fail to be sent, the method also statically activates the built-in LED of the
-         * board to visually communicate the encountered runtime error. Do not use the LED-connected pin or LED when
-         * using this method to avoid interference!
-         *
-         * @note If the message is intended to communicate only the event code, do not provide the data object.
-         * SendData() has an overloaded version specialized for sending event codes that is more efficient than the
-         * data-containing version.
-         *
-         * @tparam ObjectType The type of the data object to be sent along with the message.
-         * @param event_code The event that triggered the data transmission.
-         * @param object The data object to be sent along with the message.
-         */
-        template <typename ObjectType>
-        void SendData(const uint8_t event_code, const ObjectType& object)
+        /// Packages and sends the input event code and data value reported by the timer-executed command to the PC
+        /// after resolving the PC-configured event limits.
+        void TransmitTimedData(const uint8_t event_code, const uint32_t value) const
         {
-            // Packages and sends the data to the connected system via the Communication class. If the message was sent,
-            // ends the runtime
-            if (_communication
-                    .SendDataMessage(_module_type, _module_id, _execution_parameters.command, event_code, object))
-                return;
+            Communication& channel = GetChannel(_data_message_channel);
+            if (channel.SendDataMessage(_module_type, _module_id, _timed_command, event_code, value)) return;
+            SendTransmissionError(channel, _timed_command);
+        }
 
-            // If the message was not sent, calls a method that attempts to send a communication error message to the
-            // PC and turns on the built-in LED to visually indicate the error.
-            _communication.SendCommunicationErrorMessage(
-                _module_type,
-                _module_id,
-                _execution_parameters.command,
-                static_cast<uint8_t>(kCoreStatusCodes::kTransmissionError)
-            );
+        /// Packages and sends the input event code reported by the timer-executed command to the PC.
+        void SendTimedData(const uint8_t event_code) const
+        {
+#if AXMC_SEQUENCE_STEP_COUNT > 0
+            RecordEvent(event_code);
+#endif
+            Communication& channel = GetChannel(_state_message_channel);
+            if (channel.SendStateMessage(_module_type, _module_id, _timed_command, event_code)) return;
+            SendTransmissionError(channel, _timed_command);
         }
 
         /**
-         * @brief Packages and sends the provided event code to the PC.
+         * @brief Reserves a free hardware timer and configures it to execute the module's timed command.
          *
-         * This method overloads the SendData() method to optimize transmitting messages that only need to communicate
-         * the event.
+         * @param period The delay, in microseconds, between consecutive timed command executions.
          *
-         * @param event_code The code of the event that triggered the data transmission.
+         * @returns true if the timer was started, false if no hardware timer is available or the period is not
+         * supported by the timer.
          */
-        void SendData(const uint8_t event_code) const
+        bool StartTimedCommand(const uint32_t period)
         {
-            // Packages and sends the data to the connected system via the Communication class. If the message was
-            // sent, ends the runtime
-            if (_communication.SendStateMessage(_module_type, _module_id, _execution_parameters.command, event_code))
-                return;
+            if (period == 0) return false;
 
-            // If the message was not sent, calls a method that attempts to send a communication error message to the
-            // PC and turns on the built-in LED to visually indicate the error.
-            _communication.SendCommunicationErrorMessage(
-                _module_type,
-                _module_id,
-                _execution_parameters.command,
-                static_cast<uint8_t>(kCoreStatusCodes::kTransmissionError)
-            );
+            for (size_t i = 0; i < kTimerSlotCount; i++)
+            {
+                TimerSlot& slot = GetTimerSlots()[i];
+                if (slot.module != nullptr) continue;
+
+                slot.events.Reset();
+                slot.module = this;
+                _timer_slot = static_cast<int8_t>(i);
+
+#if defined(TEENSYDUINO)
+                // Each PIT channel requires a dedicated callback function.
+                void (*const callbacks[kTimerSlotCount])() = {
+                    &HandleTimerInterrupt<0>,
+                    &HandleTimerInterrupt<1>,
+                    &HandleTimerInterrupt<2>,
+                    &HandleTimerInterrupt<3>,
+                };
+
+                // The timer may fail to start if its PIT channel is used by another library.
+                if (slot.timer.begin(callbacks[i], period)) return true;
+                slot.module = nullptr;
+                _timer_slot = -1;
+#else
+                // The TC1 channels are clocked at MCK / 2 (42 MHz).
+                constexpr uint32_t kTicksPerMicrosecond = VARIANT_MCK / 2 / 1000000;
+                if (period > UINT32_MAX / kTicksPerMicrosecond)
+                {
+                    slot.module = nullptr;
+                    _timer_slot = -1;
+                    return false;
+                }
+
+                const auto irq = static_cast<IRQn_Type>(TC3_IRQn + i);
+                pmc_set_writeprotect(false);
+                pmc_enable_periph_clk(ID_TC3 + i);
+                TC_Configure(TC1, i, TC_CMR_WAVE | TC_CMR_WAVSEL_UP_RC | TC_CMR_TCCLKS_TIMER_CLOCK1);
+                TC_SetRC(TC1, i, period * kTicksPerMicrosecond);
+                TC1->TC_CHANNEL[i].TC_IER = TC_IER_CPCS;
+                TC1->TC_CHANNEL[i].TC_IDR = ~TC_IER_CPCS;
+                NVIC_ClearPendingIRQ(irq);
+                NVIC_EnableIRQ(irq);
+                TC_Start(TC1, i);
+                return true;
+#endif
+            }
+
+            return false;
         }
 
         /**
-         * @brief Unpacks the instance's runtime parameters received from the PC into the specified storage object.
-         *
-         * @tparam ObjectType The type of the object used to store the PC-addressable module's parameters.
-         * @param storage_object The object used to store the PC-addressable module's parameters.
-         *
-         * @returns true if the parameters were successfully unpacked, false otherwise.
+         * @brief Stops the hardware timer that executes the module's timed command, sends the remaining buffered
+         * events to the PC, and releases the timer.
          */
-        template <typename ObjectType>
-        bool ExtractParameters(ObjectType& storage_object)
+        void StopTimedCommand()
         {
-            return _communication.ExtractModuleParameters(storage_object);
+            if (_timer_slot < 0) return;
+            TimerSlot& slot = GetTimerSlots()[_timer_slot];
+
+#if defined(TEENSYDUINO)
+            slot.timer.end();
+#else
+            TC_Stop(TC1, static_cast<uint32_t>(_timer_slot));
+            NVIC_DisableIRQ(static_cast<IRQn_Type>(TC3_IRQn + _timer_slot));
+#endif
+
+            SendTimedEvents();
+            slot.module = nullptr;
+            _timer_slot = -1;
         }
+#endif
+};
 
-    private:
-        /// Stores the instance's type (family) identifier code.
-        const uint8_t _module_type;
+#if AXMC_ENABLE_TIMER_EXECUTION && !defined(TEENSYDUINO)
+// Routes the interrupts of the TC1 timer counter channels used by the timer execution mode to the Module class.
+// Reading the channel status register clears the interrupt flag.
 
-        /// Stores the instance's unique identifier code.
-        const uint8_t _module_id;
+void TC3_Handler()
+{
+    TC_GetStatus(TC1, 0);
+    Module::ServiceTimerInterrupt(0);
+}
 
-        /// Stores the instance's combined type and id uint16 code expected to be unique for each module instance
-        /// active at the same time.
-        const uint16_t _module_type_id = _module_type << 8 | _module_id;
+void TC4_Handler()
+{
+    TC_GetStatus(TC1, 1);
+    Module::ServiceTimerInterrupt(1);
+}
 
-        /// Stores the Communication instance used to send module runtime data to the PC.
-        Communication& _communication;
+void TC5_Handler()
+{
+    TC_GetStatus(TC1, 2);
+    Module::ServiceTimerInterrupt(2);
+}
+#endif
 
-        /// Stores instance-specific runtime flow control parameters.
-        ExecutionControlParameters _execution_parameters;
-};
+/**
+ * @def AXMC_COMMAND_BEGIN
+ * @brief Starts the body of a multi-stage command written with the command stage macros.
+ *
+ * The command stage macros replace the 'switch (get_command_stage())' statements of the multi-stage commands with
+ * sequential code. Each AXMC_AWAIT_MICROS, AXMC_AWAIT_UNTIL, or AXMC_YIELD macro ends the current invocation of the
+ * command and records the point at which the next invocation resumes the command's execution in the command stage.
+ * The command completes once its execution reaches the AXMC_COMMAND_END macro.
+ *
+ * @warning The macros can only be used inside member functions of the Module-derived classes that return void, and
+ * the local variables of the command do not retain their values across the await points. Store the values that have
+ * to persist across the await points as class members. Each command supports up to 254 await points, and the commands
+ * written with these macros must not call the AdvanceCommandStage() method and cannot use switch statements that span
+ * the await points.
+ *
+ * @warning Since the macros expand to the case labels of a single switch statement, any local variable declared with
+ * an initializer between the AXMC_COMMAND_BEGIN and AXMC_COMMAND_END macros fails to compile with the 'jump to case
+ * label' error, as the case labels jump past its initialization. Declare such variables inside a braced block that
+ * does not contain any await point, for example: '{ const uint16_t value = analogRead(kPin); SendData(1, value); }'.
+ */
+#define AXMC_COMMAND_BEGIN()                                                        \
+    enum : uint16_t                                                                 \
+    {                                                                               \
+        kAxmcStageBase = __COUNTER__                                                \
+    };                                                                              \
+    switch (get_command_stage())                                                    \
+    {                                                                               \
+        case 1:
+
+/**
+ * @def AXMC_COMMAND_END
+ * @brief Completes the command written with the command stage macros. Aborts the command if its stage does not match
+ * any of the command's await points.
+ */
+#define AXMC_COMMAND_END()                                                          \
+    CompleteCommand();                                                              \
+    return;                                                                         \
+    default: AbortCommand(); return;                                                \
+    }
+
+/// Implements the command stage await points. Do not use this macro directly.
+#define AXMC_AWAIT_STAGE_(stage, condition)                                         \
+    static_assert((stage) <= 255, "The command uses more than 254 await points.");  \
+    SetCommandStage(stage);                                                         \
+    [[fallthrough]];                                                                \
+    case (stage):                                                                   \
+        if (!(condition)) return;
+
+/**
+ * @def AXMC_AWAIT_MICROS
+ * @brief Suspends the command written with the command stage macros until the specified number of microseconds
+ * passes.
+ *
+ * The suspended command never blocks. The Kernel compiled with the deadline scheduler does not poll the module until
+ * the delay expires. If the command runs in the blocking mode, the Kernel does not run the commands of other modules
+ * until the delay expires.
+ */
+#define AXMC_AWAIT_MICROS(duration) AXMC_AWAIT_STAGE_(__COUNTER__ - kAxmcStageBase + 1, YieldForMicros(duration))
+
+/**
+ * @def AXMC_AWAIT_UNTIL
+ * @brief Suspends the command written with the command stage macros until the specified condition evaluates to true.
+ *
+ * @note The condition is re-evaluated during each runtime cycle.
+ */
+#define AXMC_AWAIT_UNTIL(condition) AXMC_AWAIT_STAGE_(__COUNTER__ - kAxmcStageBase + 1, condition)
+
+/**
+ * @def AXMC_YIELD
+ * @brief Suspends the command written with the command stage macros until the next runtime cycle.
+ */
+#define AXMC_YIELD() AXMC_YIELD_STAGE_(__COUNTER__ - kAxmcStageBase + 1)
+
+/// Implements the AXMC_YIELD macro. Do not use this macro directly.
+#define AXMC_YIELD_STAGE_(stage)                                                    \
+    static_assert((stage) <= 255, "The command uses more than 254 await points.");  \
+    SetCommandStage(stage);                                                         \
+    return;                                                                         \
+    case (stage):
 
 #endif  //AXMC_MODULE_H
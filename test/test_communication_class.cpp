@@ -16,6 +16,20 @@
 /// The byte capacity of the mock serial stream used to back the Communication instance in each test.
 static constexpr uint16_t kTestBufferSize = 60;
 
+/// Extends the mock serial stream to report a configurable number of bytes that can be written without blocking.
+class LimitedStreamMock final : public StreamMock<kTestBufferSize>
+{
+    public:
+        /// Returns the number of bytes the stream reports as writable without blocking.
+        int availableForWrite() override
+        {
+            return write_limit;
+        }
+
+        /// Stores the number of bytes the stream reports as writable without blocking.
+        int write_limit = 0;
+};
+
 // This function is called automatically before each test function. Currently not used.
 void setUp()
 {}
@@ -110,6 +124,53 @@ void test_send_state_message()
     }
 }
 
+// Verifies that the prepared messages sent via the Communication's SendPreparedMessage() method match the messages sent
+// via the SendDataMessage() and SendStateMessage() methods.
+void test_send_prepared_message()
+{
+    StreamMock<kTestBufferSize> mock_port;
+    Communication communication_class(mock_port);
+
+    constexpr uint8_t module_type  = 112;   // Example module type
+    constexpr uint8_t module_id    = 12;    // Example module ID
+    constexpr uint8_t command      = 88;    // Example command code
+    constexpr uint8_t event_code   = 221;   // Example event code
+    constexpr uint16_t test_object = 1000;  // Test object
+
+    // Data message test
+    auto data_message = Communication::PrepareDataMessage<uint16_t>(module_type, module_id, event_code);
+    data_message.object = test_object;
+    communication_class.SendPreparedMessage(data_message, command);
+    constexpr uint16_t data_protocol = static_cast<uint8_t>(axmc_communication_assets::kProtocols::kModuleData);
+    constexpr auto prototype_code    = static_cast<uint8_t>(axmc_communication_assets::kPrototypes::kOneUint16);
+    constexpr uint16_t expected_data[8] =
+        {data_protocol, module_type, module_id, command, event_code, prototype_code, test_object & 0xFF, 0x03};
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(axmc_shared_assets::kCommunicationStatusCodes::kMessageSent),
+        communication_class.get_communication_status()
+    );
+    for (size_t i = 0; i < 8; ++i)
+    {
+        TEST_ASSERT_EQUAL_UINT16(expected_data[i], mock_port.tx_buffer[i + 3]);
+    }
+
+    mock_port.reset();
+
+    // State message test
+    auto state_message = Communication::PrepareStateMessage(module_type, module_id, event_code);
+    communication_class.SendPreparedMessage(state_message, command);
+    constexpr uint16_t state_protocol = static_cast<uint8_t>(axmc_communication_assets::kProtocols::kModuleState);
+    constexpr uint16_t expected_state[5] = {state_protocol, module_type, module_id, command, event_code};
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(axmc_shared_assets::kCommunicationStatusCodes::kMessageSent),
+        communication_class.get_communication_status()
+    );
+    for (size_t i = 0; i < 5; ++i)
+    {
+        TEST_ASSERT_EQUAL_UINT16(expected_state[i], mock_port.tx_buffer[i + 3]);
+    }
+}
+
 // Verifies the Communication's SendCommunicationErrorMessage() method.
 void test_send_communication_error_message()
 {
@@ -227,6 +288,195 @@ void test_send_service_message()
     {
         TEST_ASSERT_EQUAL_UINT16(expected_module_identification[i], mock_port.tx_buffer[i + 3]);
     }
+
+    mock_port.reset();
+
+    // ReceptionCodes message
+    constexpr uint8_t reception_codes[3]           = {11, 22, 33};
+    constexpr uint16_t expected_reception_codes[5] = {
+        static_cast<uint8_t>(axmc_communication_assets::kProtocols::kReceptionCodes),
+        3,
+        11,
+        22,
+        33
+    };
+    communication_class.SendReceptionCodes(reception_codes, 3);
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(axmc_shared_assets::kCommunicationStatusCodes::kMessageSent),
+        communication_class.get_communication_status()
+    );
+    for (size_t i = 0; i < 5; ++i)
+    {
+        TEST_ASSERT_EQUAL_UINT16(expected_reception_codes[i], mock_port.tx_buffer[i + 3]);
+    }
+}
+
+// Verifies the Communication's message batching behavior and the SendBatchedMessages() method.
+void test_send_batched_messages()
+{
+    StreamMock<kTestBufferSize> mock_port;
+
+    // Uses a large batch age limit to ensure that the batch is only sent when explicitly requested.
+    Communication communication_class(mock_port, 1000000);
+
+    // Defines static message payload components.
+    constexpr uint8_t module_type = 112;  // Example module type
+    constexpr uint8_t module_id   = 12;   // Example module ID
+    constexpr uint8_t command     = 88;   // Example command code
+    constexpr uint8_t event_code  = 221;  // Example event code
+
+    // Batches a Kernel state message and a Module state message.
+    communication_class.SendStateMessage(command, event_code);
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(axmc_shared_assets::kCommunicationStatusCodes::kMessageBatched),
+        communication_class.get_communication_status()
+    );
+    communication_class.SendStateMessage(module_type, module_id, command, event_code);
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(axmc_shared_assets::kCommunicationStatusCodes::kMessageBatched),
+        communication_class.get_communication_status()
+    );
+
+    // Sends the batch and verifies that both messages are bundled into the same payload.
+    communication_class.SendBatchedMessages();
+    constexpr uint16_t expected_batch[10] = {
+        static_cast<uint8_t>(axmc_communication_assets::kProtocols::kBatchedMessages),
+        static_cast<uint8_t>(axmc_communication_assets::kProtocols::kKernelState),
+        command,
+        event_code,
+        static_cast<uint8_t>(axmc_communication_assets::kProtocols::kModuleState),
+        module_type,
+        module_id,
+        command,
+        event_code,
+        0
+    };
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(axmc_shared_assets::kCommunicationStatusCodes::kMessageSent),
+        communication_class.get_communication_status()
+    );
+    for (size_t i = 0; i < 10; ++i)
+    {
+        TEST_ASSERT_EQUAL_UINT16(expected_batch[i], mock_port.tx_buffer[i + 3]);
+    }
+
+    mock_port.reset();
+
+    // Verifies that service messages are never batched and send the open batch before being transmitted.
+    constexpr uint8_t service_code = 111;
+    communication_class.SendStateMessage(command, event_code);
+    communication_class.SendServiceMessage<axmc_communication_assets::kProtocols::kReceptionCode>(service_code);
+    constexpr uint16_t expected_kernel[5] = {
+        static_cast<uint8_t>(axmc_communication_assets::kProtocols::kBatchedMessages),
+        static_cast<uint8_t>(axmc_communication_assets::kProtocols::kKernelState),
+        command,
+        event_code,
+        0
+    };
+    for (size_t i = 0; i < 5; ++i)
+    {
+        TEST_ASSERT_EQUAL_UINT16(expected_kernel[i], mock_port.tx_buffer[i + 3]);
+    }
+}
+
+// Verifies the TransmissionBuffer class used to support the asynchronous transmission mode.
+void test_transmission_buffer()
+{
+    LimitedStreamMock mock_port;
+    TransmissionBuffer<8> transmission_buffer(mock_port);
+
+    const uint8_t frame_1[5] = {1, 2, 3, 4, 5};
+    const uint8_t frame_2[6] = {6, 7, 8, 9, 10, 11};
+
+    // Verifies that a frame that fits into the buffer is stored.
+    transmission_buffer.BeginFrame();
+    transmission_buffer.write(frame_1, sizeof(frame_1));
+    TEST_ASSERT_TRUE(transmission_buffer.EndFrame());
+    TEST_ASSERT_EQUAL(3, transmission_buffer.availableForWrite());
+
+    // Verifies that a frame that does not fit into the buffer is discarded entirely and counted as an overflow.
+    transmission_buffer.BeginFrame();
+    transmission_buffer.write(frame_2, sizeof(frame_2));
+    TEST_ASSERT_FALSE(transmission_buffer.EndFrame());
+    TEST_ASSERT_EQUAL_UINT32(1, transmission_buffer.get_overflow_count());
+    TEST_ASSERT_EQUAL(3, transmission_buffer.availableForWrite());
+
+    // Verifies that draining the buffer never writes more bytes than the port can accept without blocking.
+    mock_port.write_limit = 2;
+    transmission_buffer.Drain();
+    TEST_ASSERT_EQUAL_UINT16(1, mock_port.tx_buffer[0]);
+    TEST_ASSERT_EQUAL_UINT16(2, mock_port.tx_buffer[1]);
+    TEST_ASSERT_EQUAL(5, transmission_buffer.availableForWrite());
+
+    // Drains the rest of the first frame.
+    mock_port.write_limit = kTestBufferSize;
+    transmission_buffer.Drain();
+    TEST_ASSERT_EQUAL(8, transmission_buffer.availableForWrite());
+
+    // Verifies that a frame that wraps around the end of the ring buffer is transmitted in the correct order.
+    transmission_buffer.BeginFrame();
+    transmission_buffer.write(frame_2, sizeof(frame_2));
+    TEST_ASSERT_TRUE(transmission_buffer.EndFrame());
+    transmission_buffer.Drain();
+    constexpr uint16_t expected[11] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    for (size_t i = 0; i < 11; ++i)
+    {
+        TEST_ASSERT_EQUAL_UINT16(expected[i], mock_port.tx_buffer[i]);
+    }
+    TEST_ASSERT_EQUAL(8, transmission_buffer.availableForWrite());
+}
+
+// Verifies the Communication's HasTransmissionHeadroom() method used to drop the droppable messages.
+void test_transmission_headroom()
+{
+    LimitedStreamMock mock_port;
+    Communication communication(mock_port);
+
+    // A 1-byte uint8_t data message: the ModuleData header (6 bytes), the object, and the message frame service data.
+    constexpr size_t message_size = sizeof(Communication::ModuleDataHeader) + sizeof(uint8_t);
+    constexpr int frame_size      = static_cast<int>(message_size) + 4 + AXMC_CRC_WIDTH / 8;
+
+#if AXMC_TRANSMISSION_BUFFER_SIZE == 0
+    // Verifies that the droppable message can only be sent if the port can accept the whole frame without blocking.
+    mock_port.write_limit = frame_size + AXMC_CRITICAL_MESSAGE_HEADROOM;
+    TEST_ASSERT_TRUE(communication.HasTransmissionHeadroom(message_size));
+    mock_port.write_limit = frame_size + AXMC_CRITICAL_MESSAGE_HEADROOM - 1;
+    TEST_ASSERT_FALSE(communication.HasTransmissionHeadroom(message_size));
+
+    // Verifies that the ports that report no writable space drop all droppable messages.
+    mock_port.write_limit = 0;
+    TEST_ASSERT_FALSE(communication.HasTransmissionHeadroom(message_size));
+
+    // Verifies that the message that starts a new batch requires space for the batch protocol code.
+    Communication batching_communication(mock_port, 1000000);
+    mock_port.write_limit = frame_size + 1 + AXMC_CRITICAL_MESSAGE_HEADROOM;
+    TEST_ASSERT_TRUE(batching_communication.HasTransmissionHeadroom(message_size));
+    mock_port.write_limit = frame_size + AXMC_CRITICAL_MESSAGE_HEADROOM;
+    TEST_ASSERT_FALSE(batching_communication.HasTransmissionHeadroom(message_size));
+
+    // Verifies that the message that joins the open batch requires space for the whole batch frame, which already
+    // includes the batch protocol code.
+    constexpr uint8_t test_object = 1;
+    batching_communication.SendDataMessage(1, 1, 0, 51, test_object);
+    mock_port.write_limit = frame_size + 1 + static_cast<int>(message_size) + AXMC_CRITICAL_MESSAGE_HEADROOM;
+    TEST_ASSERT_TRUE(batching_communication.HasTransmissionHeadroom(message_size));
+    mock_port.write_limit -= 1;
+    TEST_ASSERT_FALSE(batching_communication.HasTransmissionHeadroom(message_size));
+
+    // Verifies that the message that does not fit into the open batch only requires space for the new batch it
+    // starts after the open batch is sent.
+    const size_t batch_capacity = (Communication::get_maximum_transmitted_payload_size() - 1) / message_size;
+    for (size_t i = 1; i < batch_capacity; ++i) batching_communication.SendDataMessage(1, 1, 0, 51, test_object);
+    mock_port.write_limit = frame_size + 1 + AXMC_CRITICAL_MESSAGE_HEADROOM;
+    TEST_ASSERT_TRUE(batching_communication.HasTransmissionHeadroom(message_size));
+#else
+    // Verifies that the droppable messages are only limited by the free space of the transmission ring buffer.
+    mock_port.write_limit = 0;
+    TEST_ASSERT_EQUAL(
+        AXMC_TRANSMISSION_BUFFER_SIZE >= frame_size + AXMC_CRITICAL_MESSAGE_HEADROOM,
+        communication.HasTransmissionHeadroom(message_size)
+    );
+#endif
 }
 
 // Verifies the Communication's ReceiveMessage() method.
@@ -513,6 +763,110 @@ void test_extract_module_parameters()
     TEST_ASSERT_EQUAL_UINT8_ARRAY(expected_data_2, test_structure.data, sizeof(expected_data_2));
 }
 
+// Verifies that the Communication's ExtractModuleParameters() method correctly resolves PartialModuleParameters
+// messages.
+void test_extract_partial_module_parameters()
+{
+    StreamMock<kTestBufferSize> mock_port;
+    Communication communication_class(mock_port);
+    CRCProcessor<uint16_t> crc_class(0x1021, 0xFFFF, 0x0000);
+    COBSProcessor cobs_class;
+
+    // Verifies that the partial update only overwrites the addressed range of the destination object's bytes.
+    uint8_t test_buffer_1[15] = {129, 9, 0, 21, 2, 3, 4, 2, 3, 7, 8, 9, 0, 0, 0};
+
+    // Packages test message data into the mock reception buffer.
+    cobs_class.EncodePayload(test_buffer_1);
+    crc_class.CalculateChecksum<false>(test_buffer_1);
+    for (size_t i = 0; i < sizeof(test_buffer_1); ++i)
+    {
+        mock_port.rx_buffer[i] = static_cast<int16_t>(test_buffer_1[i]);
+    }
+
+    uint8_t extract_data[6] = {1, 2, 3, 4, 5, 6};
+
+    // Receives the message and verifies the header. The addressing data is also available via the full parameters
+    // message header.
+    communication_class.ReceiveMessage();
+    TEST_ASSERT_EQUAL_UINT8(2, communication_class.get_module_parameters_header().module_type);
+    TEST_ASSERT_EQUAL_UINT8(3, communication_class.get_module_parameters_header().module_id);
+    TEST_ASSERT_EQUAL_UINT8(4, communication_class.get_module_parameters_header().return_code);
+    TEST_ASSERT_EQUAL_UINT8(2, communication_class.get_partial_module_parameters_header().offset);
+    TEST_ASSERT_EQUAL_UINT8(3, communication_class.get_partial_module_parameters_header().length);
+
+    // Extracts and verifies parameter data.
+    TEST_ASSERT_TRUE(communication_class.ExtractModuleParameters(extract_data));
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(axmc_shared_assets::kCommunicationStatusCodes::kParametersExtracted),
+        communication_class.get_communication_status()
+    );
+    const uint8_t expected_data[6] = {1, 2, 7, 8, 9, 6};
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected_data, extract_data, sizeof(expected_data));
+
+    mock_port.reset();
+
+    // Verifies that the partial update that does not fit into the destination object is rejected without modifying
+    // the object.
+    uint8_t test_buffer_2[15] = {129, 9, 0, 21, 2, 3, 4, 4, 3, 1, 1, 1, 0, 0, 0};
+
+    // Packages test message data into the mock reception buffer.
+    cobs_class.EncodePayload(test_buffer_2);
+    crc_class.CalculateChecksum<false>(test_buffer_2);
+    for (size_t i = 0; i < sizeof(test_buffer_2); ++i)
+    {
+        mock_port.rx_buffer[i] = static_cast<int16_t>(test_buffer_2[i]);
+    }
+
+    communication_class.ReceiveMessage();
+    TEST_ASSERT_FALSE(communication_class.ExtractModuleParameters(extract_data));
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(axmc_shared_assets::kCommunicationStatusCodes::kParameterMismatch),
+        communication_class.get_communication_status()
+    );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected_data, extract_data, sizeof(expected_data));
+}
+
+// Verifies that the Communication's BufferModuleParameters() method allows multiple modules to extract the same
+// parameter data.
+void test_buffer_module_parameters()
+{
+    StreamMock<kTestBufferSize> mock_port;
+    Communication communication_class(mock_port);
+    CRCProcessor<uint16_t> crc_class(0x1021, 0xFFFF, 0x0000);
+    COBSProcessor cobs_class;
+
+    // Instantiates the test message payload addressed to all modules of type 2.
+    uint8_t test_buffer[13] = {129, 7, 0, 5, 2, 255, 0, 7, 8, 9, 0, 0, 0};
+
+    // Packages test message data into the mock reception buffer.
+    cobs_class.EncodePayload(test_buffer);
+    crc_class.CalculateChecksum<false>(test_buffer);
+    for (size_t i = 0; i < sizeof(test_buffer); ++i)
+    {
+        mock_port.rx_buffer[i] = static_cast<int16_t>(test_buffer[i]);
+    }
+
+    communication_class.ReceiveMessage();
+    TEST_ASSERT_TRUE(communication_class.BufferModuleParameters());
+
+    // Verifies that multiple destination objects can extract the buffered parameter data.
+    const uint8_t expected_data[3] = {7, 8, 9};
+    uint8_t extract_data_1[3] = {};
+    uint8_t extract_data_2[3] = {};
+    TEST_ASSERT_TRUE(communication_class.ExtractModuleParameters(extract_data_1));
+    TEST_ASSERT_TRUE(communication_class.ExtractModuleParameters(extract_data_2));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected_data, extract_data_1, sizeof(expected_data));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected_data, extract_data_2, sizeof(expected_data));
+
+    // Verifies that the buffered data is still matched against the size of the destination object.
+    uint8_t extract_data_3[2] = {};
+    TEST_ASSERT_FALSE(communication_class.ExtractModuleParameters(extract_data_3));
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(axmc_shared_assets::kCommunicationStatusCodes::kParameterMismatch),
+        communication_class.get_communication_status()
+    );
+}
+
 // Verifies the error-handling behavior of the Communication's ExtractModuleParameters() method.
 void test_extract_module_parameters_errors()
 {
@@ -622,6 +976,7 @@ int RunUnityTests()
 
     // SendStateMessage
     RUN_TEST(test_send_state_message);
+    RUN_TEST(test_send_prepared_message);
 
     // SendCommunicationErrorMessage
     RUN_TEST(test_send_communication_error_message);
@@ -629,12 +984,21 @@ int RunUnityTests()
     // SendServiceMessage
     RUN_TEST(test_send_service_message);
 
+    // Message batching
+    RUN_TEST(test_send_batched_messages);
+
+    // Asynchronous transmission
+    RUN_TEST(test_transmission_buffer);
+    RUN_TEST(test_transmission_headroom);
+
     // ReceiveMessage
     RUN_TEST(test_receive_message);
     RUN_TEST(test_receive_message_errors);
 
     // ExtractModuleParameters
     RUN_TEST(test_extract_module_parameters);
+    RUN_TEST(test_extract_partial_module_parameters);
+    RUN_TEST(test_buffer_module_parameters);
     RUN_TEST(test_extract_module_parameters_errors);
 
     return UNITY_END();
@@ -678,3 +1042,12 @@ void setup()
 // Nothing here as all tests are done in a one-shot fashion using the 'setup' function above.
 void loop()
 {}
+
+// The 'native' environment builds the tests as a host executable, which uses the standard entry point instead of the
+// Arduino setup and loop functions.
+#if !defined(ARDUINO)
+int main()
+{
+    return RunUnityTests();
+}
+#endif